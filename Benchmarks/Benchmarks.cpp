@@ -0,0 +1,31 @@
+#include <QtTest/QtTest>
+
+#include "EncodingBenchmark.h"
+#include "LoadBenchmark.h"
+#include "SpillBenchmark.h"
+#include "TokenizerBenchmark.h"
+#include "VbxFormatBenchmark.h"
+
+int main(int argc, char* argv[])
+{
+    QLocale::setDefault(QLocale::c());
+
+    const QApplication a(argc, argv);
+
+    LoadBenchmark loadBenchmark;
+    QTest::qExec(&loadBenchmark, argc, argv);
+
+    SpillBenchmark spillBenchmark;
+    QTest::qExec(&spillBenchmark, argc, argv);
+
+    VbxFormatBenchmark vbxFormatBenchmark;
+    QTest::qExec(&vbxFormatBenchmark, argc, argv);
+
+    TokenizerBenchmark tokenizerBenchmark;
+    QTest::qExec(&tokenizerBenchmark, argc, argv);
+
+    EncodingBenchmark encodingBenchmark;
+    QTest::qExec(&encodingBenchmark, argc, argv);
+
+    return 0;
+}
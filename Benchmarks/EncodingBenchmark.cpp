@@ -0,0 +1,127 @@
+#include "EncodingBenchmark.h"
+
+#include <algorithm>
+
+#include <QtTest/QtTest>
+
+#include <Datasets/DataColumn.h>
+
+namespace
+{
+int getBenchmarkRowCount()
+{
+    const int defaultRowCount{1'000'000};
+    bool ok{false};
+    const int rowCount{qEnvironmentVariable("VOLBX_BENCHMARK_ROWS").toInt(&ok)};
+    return ok ? rowCount : defaultRowCount;
+}
+
+const int firstJulianDay{2'451'545};
+
+/// Days in range of frame of reference offsets.
+const int daysInRange{10'000};
+
+int getJulianDay(int row, int runLength)
+{
+    return firstJulianDay + (row / runLength) % daysInRange;
+}
+
+/// Lookup of row done by DataColumn for RUN_LENGTH encoding.
+qint64 scanRunLength(int rowCount, int runLength)
+{
+    QVector<qint32> runStarts;
+    QVector<double> runValues;
+    for (int row = 0; row < rowCount; row += runLength)
+    {
+        runStarts.append(row);
+        runValues.append(getJulianDay(row, runLength));
+    }
+
+    qint64 sum{0};
+    QBENCHMARK
+    {
+        sum = 0;
+        for (int row = 0; row < rowCount; ++row)
+        {
+            const auto it{
+                std::upper_bound(runStarts.cbegin(), runStarts.cend(), row)};
+            sum += static_cast<qint64>(
+                runValues[static_cast<qsizetype>(it - runStarts.cbegin()) -
+                          1]);
+        }
+    }
+    return sum;
+}
+
+/// Lookup of row done by DataColumn for FRAME_OF_REFERENCE encoding.
+qint64 scanFrameOfReference(int rowCount, int runLength)
+{
+    QVector<quint16> dayOffsets(rowCount);
+    for (int row = 0; row < rowCount; ++row)
+        dayOffsets[row] =
+            static_cast<quint16>(getJulianDay(row, runLength) - firstJulianDay);
+
+    qint64 sum{0};
+    QBENCHMARK
+    {
+        sum = 0;
+        for (int row = 0; row < rowCount; ++row)
+            sum += firstJulianDay + dayOffsets[row];
+    }
+    return sum;
+}
+
+/// Encoding chosen by DataColumn itself.
+qint64 scanColumn(int rowCount, int runLength)
+{
+    DataColumn dates(ColumnType::DATE, rowCount);
+    for (int row = 0; row < rowCount; ++row)
+        dates.setJulianDay(row, getJulianDay(row, runLength));
+    dates.finishFilling();
+    qInfo() << "Average run" << runLength << "encoded as"
+            << (dates.getEncoding() == DataColumn::Encoding::RUN_LENGTH
+                    ? "run length"
+                    : "frame of reference");
+
+    qint64 sum{0};
+    QBENCHMARK
+    {
+        sum = 0;
+        for (int row = 0; row < rowCount; ++row)
+            sum += dates.getJulianDay(row);
+    }
+    return sum;
+}
+}  // namespace
+
+void EncodingBenchmark::benchmarkScan_data()
+{
+    QTest::addColumn<int>("runLength");
+    QTest::addColumn<QString>("encoding");
+
+    for (const int runLength : {1, 8, 64, 512, 4096})
+        for (const QString& encoding : {QStringLiteral("run length"),
+                                        QStringLiteral("frame of reference"),
+                                        QStringLiteral("column")})
+        {
+            const QString name{"run " + QString::number(runLength) + ", " +
+                               encoding};
+            QTest::newRow(name.toStdString().c_str()) << runLength << encoding;
+        }
+}
+
+void EncodingBenchmark::benchmarkScan()
+{
+    QFETCH(const int, runLength);
+    QFETCH(const QString, encoding);
+
+    const int rowCount{getBenchmarkRowCount()};
+    qint64 sum{0};
+    if (encoding == QStringLiteral("run length"))
+        sum = scanRunLength(rowCount, runLength);
+    else if (encoding == QStringLiteral("frame of reference"))
+        sum = scanFrameOfReference(rowCount, runLength);
+    else
+        sum = scanColumn(rowCount, runLength);
+    QVERIFY(sum > 0);
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <QObject>
+
+/**
+ * @brief Benchmark of scanning dates encoded using run length and frame of
+ * reference for various average lengths of runs. Backs minimal average run
+ * length for which DataColumn prefers run length encoding.
+ */
+class EncodingBenchmark : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    static void benchmarkScan_data();
+
+    static void benchmarkScan();
+};
@@ -0,0 +1,113 @@
+#include "LoadBenchmark.h"
+
+#include <quazip/quazip.h>
+#include <quazip/quazipfile.h>
+#include <QtTest/QtTest>
+
+#include <Common/DatasetUtilities.h>
+#include <Datasets/DatasetInner.h>
+
+#include "SyntheticDataset.h"
+
+const QString LoadBenchmark::datasetName_{QStringLiteral("syntheticLoad")};
+
+namespace
+{
+unsigned int getBenchmarkRowCount()
+{
+    const unsigned int defaultRowCount{10'000'000};
+    bool ok{false};
+    const unsigned int rowCount{
+        qEnvironmentVariable("VOLBX_BENCHMARK_ROWS").toUInt(&ok)};
+    return ok ? rowCount : defaultRowCount;
+}
+
+bool openZipFile(QuaZip& zip, QuaZipFile& zipFile, const QString& fileName)
+{
+    zipFile.setZip(&zip);
+    return zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(fileName));
+}
+}  // namespace
+
+void LoadBenchmark::initTestCase()
+{
+    QVERIFY(DatasetUtilities::doesDatasetDirExistAndUserHavePermisions());
+    QVERIFY(writeSyntheticVbx(getBenchmarkRowCount()));
+}
+
+void LoadBenchmark::benchmarkLoad()
+{
+    QBENCHMARK_ONCE
+    {
+        DatasetInner dataset(datasetName_);
+        QVERIFY(dataset.initialize());
+        dataset.setActiveColumns(
+            QVector<bool>(static_cast<int>(dataset.columnCount()), true));
+        QVERIFY(dataset.loadData());
+        qInfo() << dataset.rowCount() << "rows loaded";
+    }
+}
+
+void LoadBenchmark::cleanupTestCase()
+{
+    DatasetUtilities::removeDataset(datasetName_);
+}
+
+bool LoadBenchmark::writeSyntheticVbx(unsigned int rowCount)
+{
+    SyntheticDataset definition(datasetName_, rowCount);
+    if (!definition.initialize())
+        return false;
+
+    QuaZip zip(DatasetUtilities::getDatasetsDir() + datasetName_ +
+               DatasetUtilities::getDatasetExtension());
+    if (!zip.open(QuaZip::mdCreate))
+        return false;
+
+    QuaZipFile zipFile;
+    if (!openZipFile(zip, zipFile,
+                     DatasetUtilities::getDatasetDefinitionFilename()) ||
+        zipFile.write(definition.definitionToXml(rowCount)) == -1)
+        return false;
+    zipFile.close();
+
+    const int distinctStrings{100'000};
+    if (!openZipFile(zip, zipFile,
+                     DatasetUtilities::getDatasetStringsFilename()))
+        return false;
+    for (int i = 0; i < distinctStrings; ++i)
+    {
+        const QByteArray line{"street " + QByteArray::number(i) +
+                              (i + 1 < distinctStrings ? "\n" : "")};
+        if (zipFile.write(line) == -1)
+            return false;
+    }
+    zipFile.close();
+
+    if (!openZipFile(zip, zipFile, DatasetUtilities::getDatasetDataFilename()))
+        return false;
+    const int firstJulianDay{2'451'545};
+    const int daysInRange{7300};
+    const int priceModulo{10'000};
+    const int flushSize{1024 * 1024};
+    QByteArray buffer;
+    for (unsigned int row = 0; row < rowCount; ++row)
+    {
+        buffer.append(QByteArray::number(firstJulianDay + row % daysInRange));
+        buffer.append(';');
+        buffer.append(QByteArray::number(row % priceModulo));
+        buffer.append(';');
+        // Index 0 is reserved for empty string.
+        buffer.append(QByteArray::number(1 + row % distinctStrings));
+        buffer.append('\n');
+        if (buffer.size() < flushSize)
+            continue;
+        if (zipFile.write(buffer) == -1)
+            return false;
+        buffer.clear();
+    }
+    const bool written{zipFile.write(buffer) != -1};
+    zipFile.close();
+    zip.close();
+    return written;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <QObject>
+
+/**
+ * @brief Benchmark of loading large generated .vbx file.
+ */
+class LoadBenchmark : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase();
+
+    static void benchmarkLoad();
+
+    void cleanupTestCase();
+
+private:
+    static bool writeSyntheticVbx(unsigned int rowCount);
+
+    static const QString datasetName_;
+};
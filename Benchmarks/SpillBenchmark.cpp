@@ -0,0 +1,102 @@
+#include "SpillBenchmark.h"
+
+#include <QtTest/QtTest>
+
+#include <Common/DatasetUtilities.h>
+#include <ModelsAndViews/FilteringProxyModel.h>
+#include <ModelsAndViews/PlotDataProvider.h>
+#include <ModelsAndViews/TableModel.h>
+
+#include "SyntheticDataset.h"
+
+namespace
+{
+unsigned int getBenchmarkRowCount()
+{
+    // Fits any development machine, 50M rows can be set in environment.
+    const unsigned int defaultRowCount{2'000'000};
+    bool ok{false};
+    const unsigned int rowCount{
+        qEnvironmentVariable("VOLBX_BENCHMARK_ROWS").toUInt(&ok)};
+    return ok ? rowCount : defaultRowCount;
+}
+}  // namespace
+
+void SpillBenchmark::initTestCase()
+{
+    QVERIFY(DatasetUtilities::doesDatasetDirExistAndUserHavePermisions());
+    inMemoryModel_ = createModel(false);
+    spilledModel_ = createModel(true);
+    QVERIFY(spilledModel_->getMemoryUsage().spilled_ > 0);
+
+    inMemoryProxy_ = std::make_unique<FilteringProxyModel>();
+    inMemoryProxy_->setSourceModel(inMemoryModel_.get());
+    spilledProxy_ = std::make_unique<FilteringProxyModel>();
+    spilledProxy_->setSourceModel(spilledModel_.get());
+}
+
+void SpillBenchmark::benchmarkFilterInMemory()
+{
+    QBENCHMARK { filter(*inMemoryProxy_); }
+}
+
+void SpillBenchmark::benchmarkFilterSpilled()
+{
+    QBENCHMARK { filter(*spilledProxy_); }
+}
+
+void SpillBenchmark::benchmarkRecomputeInMemory()
+{
+    QBENCHMARK { recompute(*inMemoryProxy_); }
+}
+
+void SpillBenchmark::benchmarkRecomputeSpilled()
+{
+    QBENCHMARK { recompute(*spilledProxy_); }
+}
+
+void SpillBenchmark::cleanupTestCase()
+{
+    inMemoryProxy_.reset();
+    spilledProxy_.reset();
+    inMemoryModel_.reset();
+    spilledModel_.reset();
+}
+
+std::unique_ptr<TableModel> SpillBenchmark::createModel(bool spill)
+{
+    auto dataset{std::make_unique<SyntheticDataset>(
+        QStringLiteral("synthetic"), getBenchmarkRowCount())};
+    dataset->initialize();
+    if (spill)
+        dataset->setSpillDirectory(DatasetUtilities::getSpillDir());
+    dataset->loadData();
+    return std::make_unique<TableModel>(std::move(dataset));
+}
+
+void SpillBenchmark::filter(FilteringProxyModel& proxyModel)
+{
+    const double from{1000.};
+    const double to{5000.};
+    proxyModel.setNumericFilter(1, from, to);
+    proxyModel.setStringFilter(2, {QStringLiteral("east")});
+}
+
+void SpillBenchmark::recompute(const FilteringProxyModel& proxyModel)
+{
+    const int rowCount{proxyModel.rowCount()};
+    QVector<TransactionData> calcData;
+    calcData.reserve(rowCount);
+    for (int row = 0; row < rowCount; ++row)
+    {
+        TransactionData transactionData;
+        transactionData.date_ = proxyModel.index(row, 0).data().toDate();
+        transactionData.pricePerMeter_ =
+            proxyModel.index(row, 1).data().toDouble();
+        transactionData.groupedBy_ = proxyModel.index(row, 2).data();
+        calcData.append(std::move(transactionData));
+    }
+
+    PlotDataProvider plotDataProvider;
+    plotDataProvider.recompute(std::move(calcData), ColumnType::STRING);
+}
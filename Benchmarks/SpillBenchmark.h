@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+
+#include <QObject>
+
+class TableModel;
+class FilteringProxyModel;
+
+/**
+ * @brief Benchmarks of filtering and plot data recomputation with columns
+ * kept in memory and spilled to memory-mapped files.
+ */
+class SpillBenchmark : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase();
+
+    void benchmarkFilterInMemory();
+
+    void benchmarkFilterSpilled();
+
+    void benchmarkRecomputeInMemory();
+
+    void benchmarkRecomputeSpilled();
+
+    void cleanupTestCase();
+
+private:
+    static std::unique_ptr<TableModel> createModel(bool spill);
+
+    static void filter(FilteringProxyModel& proxyModel);
+
+    static void recompute(const FilteringProxyModel& proxyModel);
+
+    std::unique_ptr<TableModel> inMemoryModel_;
+
+    std::unique_ptr<TableModel> spilledModel_;
+
+    std::unique_ptr<FilteringProxyModel> inMemoryProxy_;
+
+    std::unique_ptr<FilteringProxyModel> spilledProxy_;
+};
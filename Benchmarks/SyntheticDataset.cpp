@@ -0,0 +1,67 @@
+#include "SyntheticDataset.h"
+
+#include <algorithm>
+
+#include <QDate>
+
+SyntheticDataset::SyntheticDataset(const QString& name, unsigned int rowCount,
+                                   QObject* parent)
+    : Dataset(name, parent), generatedRowCount_(rowCount)
+{
+}
+
+bool SyntheticDataset::analyze()
+{
+    columnTypes_ = {ColumnType::DATE, ColumnType::NUMBER, ColumnType::STRING};
+    headerColumnNames_ = {QStringLiteral("date"), QStringLiteral("price"),
+                          QStringLiteral("district")};
+    columnsCount_ = static_cast<unsigned int>(columnTypes_.size());
+    rowsCount_ = generatedRowCount_;
+    activeColumns_ = QVector<bool>(static_cast<int>(columnsCount_), true);
+    setTaggedColumn(ColumnTag::DATE, 0);
+    setTaggedColumn(ColumnTag::VALUE, 1);
+    valid_ = true;
+    return true;
+}
+
+std::tuple<bool, QVector<QVector<QVariant>>> SyntheticDataset::getSample()
+{
+    return {true, generateRows(0, std::min(rowCount(), SAMPLE_SIZE))};
+}
+
+bool SyntheticDataset::pushAllData()
+{
+    for (unsigned int firstRow = 0; firstRow < rowCount();
+         firstRow += BATCH_SIZE)
+    {
+        const unsigned int batchSize{
+            std::min(BATCH_SIZE, rowCount() - firstRow)};
+        QVector<QVector<QVariant>> rows{generateRows(firstRow, batchSize)};
+        pushRows(rows);
+    }
+    return true;
+}
+
+void SyntheticDataset::closeZip() {}
+
+QVector<QVector<QVariant>> SyntheticDataset::generateRows(
+    unsigned int firstRow, unsigned int rowCount) const
+{
+    const QStringList districts{
+        QStringLiteral("north"), QStringLiteral("south"),
+        QStringLiteral("east"),  QStringLiteral("west"),
+        QStringLiteral("centre")};
+    const QDate firstDate(2000, 1, 1);
+    const int daysInRange{7300};
+    const int priceModulo{10'000};
+
+    QVector<QVector<QVariant>> rows(static_cast<int>(rowCount));
+    for (int i = 0; i < static_cast<int>(rowCount); ++i)
+    {
+        const int row{static_cast<int>(firstRow) + i};
+        rows[i] = {QVariant(firstDate.addDays(row % daysInRange)),
+                   QVariant(static_cast<double>(row % priceModulo)),
+                   QVariant(districts[row % districts.size()])};
+    }
+    return rows;
+}
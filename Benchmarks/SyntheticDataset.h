@@ -0,0 +1,31 @@
+#pragma once
+
+#include <Dataset.h>
+
+/**
+ * @brief Dataset with generated date, price and district columns.
+ */
+class SyntheticDataset : public Dataset
+{
+    Q_OBJECT
+public:
+    SyntheticDataset(const QString& name, unsigned int rowCount,
+                     QObject* parent = nullptr);
+
+protected:
+    bool analyze() override;
+
+    std::tuple<bool, QVector<QVector<QVariant>>> getSample() override;
+
+    bool pushAllData() override;
+
+    void closeZip() override;
+
+private:
+    QVector<QVector<QVariant>> generateRows(unsigned int firstRow,
+                                            unsigned int rowCount) const;
+
+    static constexpr unsigned int BATCH_SIZE{65'536};
+
+    const unsigned int generatedRowCount_;
+};
@@ -0,0 +1,121 @@
+#include "TokenizerBenchmark.h"
+
+#include <cstring>
+
+#include <QtTest/QtTest>
+
+#include <Datasets/InnerLineTokenizer.h>
+
+namespace
+{
+unsigned int getBenchmarkRowCount()
+{
+    const unsigned int defaultRowCount{1'000'000};
+    bool ok{false};
+    const unsigned int rowCount{
+        qEnvironmentVariable("VOLBX_BENCHMARK_ROWS").toUInt(&ok)};
+    return ok ? rowCount : defaultRowCount;
+}
+
+/// Conversion of field as done before byte tokenizer was introduced.
+QVariant getElementAsVariant(ColumnType columnType, QStringView element)
+{
+    if (element.isEmpty())
+        return {};
+
+    switch (columnType)
+    {
+        case ColumnType::NUMBER:
+            return QVariant(element.toDouble());
+
+        case ColumnType::STRING:
+            return QVariant(element.toInt());
+
+        case ColumnType::DATE:
+            return QVariant(QDate::fromJulianDay(element.toInt()));
+
+        case ColumnType::UNKNOWN:
+            break;
+    }
+    return {};
+}
+}  // namespace
+
+void TokenizerBenchmark::initTestCase()
+{
+    const unsigned int rowCount{getBenchmarkRowCount()};
+    const int firstJulianDay{2'451'545};
+    for (unsigned int row = 0; row < rowCount; ++row)
+    {
+        const QByteArray number{QByteArray::number(row * 0.25)};
+        data_ += QByteArray::number(row % 1000) + ';' + number + ';' +
+                 QByteArray::number(firstJulianDay + row % 3650) + ';' +
+                 number + ';' + number + ";;" +
+                 QByteArray::number(row % 7) + '\n';
+    }
+}
+
+void TokenizerBenchmark::addActiveColumnsCases()
+{
+    QTest::addColumn<bool>("allActive");
+    QTest::newRow("all columns") << true;
+    QTest::newRow("two columns") << false;
+}
+
+QVector<bool> TokenizerBenchmark::getActiveColumns(bool allActive) const
+{
+    QVector<bool> activeColumns(columnTypes_.size(), allActive);
+    activeColumns[1] = true;
+    activeColumns[2] = true;
+    return activeColumns;
+}
+
+void TokenizerBenchmark::benchmarkStringPath_data() { addActiveColumnsCases(); }
+
+void TokenizerBenchmark::benchmarkStringPath() const
+{
+    QFETCH(const bool, allActive);
+    const QVector<bool> activeColumns{getActiveColumns(allActive)};
+    qsizetype convertedFields{0};
+    QBENCHMARK_ONCE
+    {
+        QTextStream stream(data_);
+        QString line;
+        while (stream.readLineInto(&line))
+        {
+            const QList<QStringView> elements{QStringView(line).split(';')};
+            QVector<QVariant> row;
+            for (int column = 0; column < columnTypes_.size(); ++column)
+                if (activeColumns[column])
+                    row.append(getElementAsVariant(columnTypes_[column],
+                                                   elements.at(column)));
+            convertedFields += row.size();
+        }
+    }
+    QVERIFY(convertedFields > 0);
+}
+
+void TokenizerBenchmark::benchmarkBytePath_data() { addActiveColumnsCases(); }
+
+void TokenizerBenchmark::benchmarkBytePath() const
+{
+    QFETCH(const bool, allActive);
+    const InnerLineTokenizer tokenizer(columnTypes_,
+                                       getActiveColumns(allActive));
+    qsizetype convertedFields{0};
+    QBENCHMARK_ONCE
+    {
+        const char* current{data_.cbegin()};
+        const char* end{data_.cend()};
+        while (current < end)
+        {
+            const auto* lineEnd{static_cast<const char*>(
+                std::memchr(current, '\n', end - current))};
+            if (lineEnd == nullptr)
+                lineEnd = end;
+            convertedFields += tokenizer.tokenize(current, lineEnd).size();
+            current = lineEnd + 1;
+        }
+    }
+    QVERIFY(convertedFields > 0);
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <ColumnType.h>
+#include <QByteArray>
+#include <QObject>
+#include <QVector>
+
+/**
+ * @brief Benchmark of converting lines of inner format data file using
+ * strings and using byte tokenizer.
+ */
+class TokenizerBenchmark : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase();
+
+    static void benchmarkStringPath_data();
+    void benchmarkStringPath() const;
+
+    static void benchmarkBytePath_data();
+    void benchmarkBytePath() const;
+
+private:
+    static void addActiveColumnsCases();
+
+    QVector<bool> getActiveColumns(bool allActive) const;
+
+    QByteArray data_;
+
+    const QVector<ColumnType> columnTypes_{
+        ColumnType::STRING, ColumnType::NUMBER, ColumnType::DATE,
+        ColumnType::NUMBER, ColumnType::NUMBER, ColumnType::NUMBER,
+        ColumnType::STRING};
+};
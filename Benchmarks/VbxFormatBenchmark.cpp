@@ -0,0 +1,156 @@
+#include "VbxFormatBenchmark.h"
+
+#include <quazip/quazip.h>
+#include <quazip/quazipfile.h>
+#include <QTableView>
+#include <QtTest/QtTest>
+
+#include <Common/DatasetUtilities.h>
+#include <Datasets/DatasetInner.h>
+#include <Export/ExportVbx.h>
+#include <ModelsAndViews/FilteringProxyModel.h>
+#include <ModelsAndViews/TableModel.h>
+
+namespace
+{
+unsigned int getBenchmarkRowCount()
+{
+    const unsigned int defaultRowCount{2'000'000};
+    bool ok{false};
+    const unsigned int rowCount{
+        qEnvironmentVariable("VOLBX_BENCHMARK_ROWS").toUInt(&ok)};
+    return ok ? rowCount : defaultRowCount;
+}
+
+QByteArray readZipFile(QuaZip& zip, const QString& fileName)
+{
+    zip.setCurrentFile(fileName);
+    QuaZipFile zipFile(&zip);
+    if (!zipFile.open(QIODevice::ReadOnly))
+        return {};
+    return zipFile.readAll();
+}
+
+bool writeZipFile(QuaZip& zip, const QString& fileName,
+                  const QByteArray& content, int repeats)
+{
+    QuaZipFile zipFile(&zip);
+    if (!zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(fileName)))
+        return false;
+    for (int i = 0; i < repeats; ++i)
+        if (zipFile.write(content) == -1)
+            return false;
+    return true;
+}
+}  // namespace
+
+void VbxFormatBenchmark::initTestCase()
+{
+    QVERIFY(DatasetUtilities::doesDatasetDirExistAndUserHavePermisions());
+    for (const auto& datasetName : datasetNames_)
+    {
+        QVERIFY(writeScaledTextVbx(datasetName, getBenchmarkRowCount()));
+        QVERIFY(writeColumnarVbx(datasetName));
+    }
+}
+
+void VbxFormatBenchmark::benchmarkLoad_data()
+{
+    QTest::addColumn<QString>("datasetName");
+    for (const auto& datasetName : datasetNames_)
+    {
+        const QString textName{getTextName(datasetName)};
+        QTest::newRow(textName.toStdString().c_str()) << textName;
+        const QString columnarName{getColumnarName(datasetName)};
+        QTest::newRow(columnarName.toStdString().c_str()) << columnarName;
+    }
+}
+
+void VbxFormatBenchmark::benchmarkLoad()
+{
+    QFETCH(const QString, datasetName);
+    QBENCHMARK_ONCE
+    {
+        DatasetInner dataset(datasetName);
+        QVERIFY(dataset.initialize());
+        dataset.setActiveColumns(
+            QVector<bool>(static_cast<int>(dataset.columnCount()), true));
+        QVERIFY(dataset.loadData());
+        qInfo() << datasetName << dataset.rowCount() << "rows";
+    }
+}
+
+void VbxFormatBenchmark::cleanupTestCase()
+{
+    for (const auto& datasetName : datasetNames_)
+    {
+        DatasetUtilities::removeDataset(getTextName(datasetName));
+        DatasetUtilities::removeDataset(getColumnarName(datasetName));
+    }
+}
+
+bool VbxFormatBenchmark::writeScaledTextVbx(const QString& datasetName,
+                                            unsigned int minimumRowCount)
+{
+    DatasetInner original(datasetName);
+    if (!original.initialize() || original.rowCount() == 0)
+        return false;
+
+    QuaZip originalZip(DatasetUtilities::getDatasetsDir() + datasetName +
+                       DatasetUtilities::getDatasetExtension());
+    if (!originalZip.open(QuaZip::mdUnzip))
+        return false;
+    QByteArray data{
+        readZipFile(originalZip, DatasetUtilities::getDatasetDataFilename())};
+    const QByteArray strings{readZipFile(
+        originalZip, DatasetUtilities::getDatasetStringsFilename())};
+    originalZip.close();
+    if (!data.endsWith('\n'))
+        data.append('\n');
+
+    const unsigned int repeats{
+        (minimumRowCount + original.rowCount() - 1) / original.rowCount()};
+    QuaZip zip(DatasetUtilities::getDatasetsDir() + getTextName(datasetName) +
+               DatasetUtilities::getDatasetExtension());
+    return zip.open(QuaZip::mdCreate) &&
+           writeZipFile(
+               zip, DatasetUtilities::getDatasetDefinitionFilename(),
+               original.definitionToXml(repeats * original.rowCount()), 1) &&
+           writeZipFile(zip, DatasetUtilities::getDatasetStringsFilename(),
+                        strings, 1) &&
+           writeZipFile(zip, DatasetUtilities::getDatasetDataFilename(), data,
+                        static_cast<int>(repeats));
+}
+
+bool VbxFormatBenchmark::writeColumnarVbx(const QString& datasetName)
+{
+    auto dataset{std::make_unique<DatasetInner>(getTextName(datasetName))};
+    if (!dataset->initialize())
+        return false;
+    dataset->setActiveColumns(
+        QVector<bool>(static_cast<int>(dataset->columnCount()), true));
+    if (!dataset->loadData())
+        return false;
+
+    TableModel model(std::move(dataset));
+    FilteringProxyModel proxyModel;
+    proxyModel.setSourceModel(&model);
+    QTableView view;
+    view.setModel(&proxyModel);
+
+    QFile file(DatasetUtilities::getDatasetsDir() +
+               getColumnarName(datasetName) +
+               DatasetUtilities::getDatasetExtension());
+    ExportVbx exportVbx(DatasetFormat::COLUMNAR);
+    return exportVbx.generateVbx(view, file);
+}
+
+QString VbxFormatBenchmark::getTextName(const QString& datasetName)
+{
+    return datasetName + "_scaledText";
+}
+
+QString VbxFormatBenchmark::getColumnarName(const QString& datasetName)
+{
+    return datasetName + "_scaledColumnar";
+}
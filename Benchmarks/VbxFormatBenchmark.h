@@ -0,0 +1,33 @@
+#pragma once
+
+#include <QObject>
+#include <QStringList>
+
+/**
+ * @brief Benchmark of loading test datasets scaled up to millions of rows,
+ * stored in text and columnar .vbx formats.
+ */
+class VbxFormatBenchmark : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase();
+
+    void benchmarkLoad_data();
+
+    static void benchmarkLoad();
+
+    void cleanupTestCase();
+
+private:
+    static bool writeScaledTextVbx(const QString& datasetName,
+                                   unsigned int minimumRowCount);
+
+    static bool writeColumnarVbx(const QString& textDatasetName);
+
+    static QString getTextName(const QString& datasetName);
+
+    static QString getColumnarName(const QString& datasetName);
+
+    const QStringList datasetNames_{"ExampleData", "po0", "po1", "pustePola"};
+};
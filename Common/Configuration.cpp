@@ -83,7 +83,15 @@ QString Configuration::configDump() const
         dump.append(QStringLiteral("\n"));
     }
 
-    dump.append("Style: " + styleName_);
+    dump.append("Style: " + styleName_ + "\n");
+
+    dump.append(QStringLiteral("Spilling enabled = "));
+    dump.append((spillingEnabled_ ? QStringLiteral("Yes")
+                                  : QStringLiteral("No")));
+    dump.append(QStringLiteral("\n"));
+
+    dump.append("Spreadsheet cache size = " +
+                QString::number(spreadsheetCacheSize_) + " MB");
 
     return dump;
 }
@@ -134,6 +142,18 @@ void Configuration::parseConfigXml(QDomDocument& configXml)
     const QDomElement importPathElement{list.at(0).toElement()};
     if (!importPathElement.isNull())
         importFilePath_ = importPathElement.attribute(XML_NAME_VALUE);
+
+    list = configXml.elementsByTagName(XML_NAME_SPILL);
+    const QDomElement spillElement{list.at(0).toElement()};
+    if (!spillElement.isNull())
+        spillingEnabled_ =
+            (spillElement.attribute(XML_NAME_VALUE).toInt() != 0);
+
+    list = configXml.elementsByTagName(XML_NAME_SPREADSHEET_CACHE);
+    const QDomElement cacheElement{list.at(0).toElement()};
+    if (!cacheElement.isNull())
+        spreadsheetCacheSize_ =
+            cacheElement.attribute(XML_NAME_VALUE).toUInt();
 }
 
 QString Configuration::generateConfigXml() const
@@ -155,6 +175,15 @@ QString Configuration::generateConfigXml() const
     importPath.setAttribute(XML_NAME_VALUE, importFilePath_);
     root.appendChild(importPath);
 
+    QDomElement spill = doc.createElement(XML_NAME_SPILL);
+    spill.setAttribute(XML_NAME_VALUE,
+                       QString::number(static_cast<int>(spillingEnabled_)));
+    root.appendChild(spill);
+
+    QDomElement cache = doc.createElement(XML_NAME_SPREADSHEET_CACHE);
+    cache.setAttribute(XML_NAME_VALUE, QString::number(spreadsheetCacheSize_));
+    root.appendChild(cache);
+
     return doc.toString();
 }
 
@@ -206,3 +235,20 @@ void Configuration::setImportFilePath(const QString& path)
 {
     importFilePath_ = path;
 }
+
+bool Configuration::isSpillingEnabled() const { return spillingEnabled_; }
+
+void Configuration::setSpillingEnabled(bool enabled)
+{
+    spillingEnabled_ = enabled;
+}
+
+unsigned int Configuration::getSpreadsheetCacheSize() const
+{
+    return spreadsheetCacheSize_;
+}
+
+void Configuration::setSpreadsheetCacheSize(unsigned int sizeInMegabytes)
+{
+    spreadsheetCacheSize_ = sizeInMegabytes;
+}
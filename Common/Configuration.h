@@ -63,6 +63,22 @@ public:
 
     void setImportFilePath(const QString& path);
 
+    /**
+     * @brief Check if large columns should be paged to spill files.
+     * @return True if spilling is enabled, false otherwise.
+     */
+    bool isSpillingEnabled() const;
+
+    void setSpillingEnabled(bool enabled);
+
+    /**
+     * @brief Get size limit of cache of spreadsheets converted to .vbx.
+     * @return Limit in MB, 0 when cache is disabled.
+     */
+    unsigned int getSpreadsheetCacheSize() const;
+
+    void setSpreadsheetCacheSize(unsigned int sizeInMegabytes);
+
 private:
     Configuration();
     ~Configuration() = default;
@@ -92,9 +108,16 @@ private:
 
     UpdatePolicy updatePolicy_{UpdatePolicy::NOT_DECIDED};
 
+    bool spillingEnabled_{false};
+
+    unsigned int spreadsheetCacheSize_{1024};
+
     const QString XML_NAME_CONFIG{QStringLiteral("CONFIG")};
     const QString XML_NAME_UPDATE{QStringLiteral("UPDATE")};
     const QString XML_NAME_VALUE{QStringLiteral("VALUE")};
     const QString XML_NAME_STYLE{QStringLiteral("STYLE")};
     const QString XML_NAME_IMPORTPATH{QStringLiteral("IMPORTPATH")};
+    const QString XML_NAME_SPILL{QStringLiteral("SPILL")};
+    const QString XML_NAME_SPREADSHEET_CACHE{
+        QStringLiteral("SPREADSHEETCACHE")};
 };
@@ -32,6 +32,19 @@ QString timeFromTimeToSeconds(QElapsedTimer time)
                            milisecondsInSecond);
 }
 
+QString bytesToMegabytes(quint64 bytes)
+{
+    const double bytesInMegabyte{1024. * 1024.};
+    return QString::number(static_cast<double>(bytes) / bytesInMegabyte, 'f',
+                           2);
+}
+
+quint64 megabytesToBytes(unsigned int megabytes)
+{
+    const quint64 bytesInMegabyte{1024 * 1024};
+    return megabytes * bytesInMegabyte;
+}
+
 int getProgressBarFullCounter()
 {
     const int fullCounter{100};
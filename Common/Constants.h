@@ -32,5 +32,9 @@ const int NOT_SET_COLUMN{-1};
 
 QString timeFromTimeToSeconds(QElapsedTimer time);
 
+QString bytesToMegabytes(quint64 bytes);
+
+quint64 megabytesToBytes(unsigned int megabytes);
+
 int getProgressBarFullCounter();
 };  // namespace Constants
@@ -0,0 +1,22 @@
+#pragma once
+
+/**
+ * @brief Versions of layout of inner .vbx format.
+ */
+enum class DatasetFormat : unsigned char
+{
+    TEXT = 1,     // Rows as text in data.csv, strings in strings.txt.
+    COLUMNAR = 2  // Blocks of values, zone maps and dictionaries of columns.
+};
+
+/// Default number of rows stored in one block of column in COLUMNAR format.
+constexpr unsigned int COLUMNAR_BLOCK_ROWS{65'536};
+
+/// Zone maps of STRING columns in COLUMNAR format list codes present in
+/// block, up to this count. Blocks with more distinct strings are marked
+/// with COLUMNAR_ZONE_ANY_CODE instead, so zone maps do not grow with size
+/// of dictionary.
+constexpr unsigned int COLUMNAR_ZONE_MAX_CODES{256};
+
+/// Count of codes in zone map of block which can hold any string.
+constexpr unsigned int COLUMNAR_ZONE_ANY_CODE{0xFFFF'FFFF};
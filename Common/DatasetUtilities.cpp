@@ -41,6 +41,8 @@ bool removeDataset(const QString& datasetName)
 {
     const QString datasetFile{getDatasetsDir() + datasetName +
                               getDatasetExtension()};
+    QFile::remove(getDatasetsDir() + datasetName +
+                  getDatasetStatisticsExtension());
     return QFile::remove(datasetFile);
 }
 
@@ -53,8 +55,51 @@ QString getDatasetDataFilename() { return QStringLiteral("data.csv"); }
 
 QString getDatasetStringsFilename() { return QStringLiteral("strings.txt"); }
 
+QString getDatasetColumnFilename(int column, int block)
+{
+    return "column" + QString::number(column) + "_" + QString::number(block) +
+           ".bin";
+}
+
+QString getDatasetZonesFilename(int column)
+{
+    return "column" + QString::number(column) + ".zones";
+}
+
+QString getDatasetDictionaryFilename(int column)
+{
+    return "column" + QString::number(column) + ".dict";
+}
+
 QString getDatasetExtension() { return QStringLiteral(".vbx"); }
 
+QString getDatasetStatisticsExtension() { return QStringLiteral(".stats"); }
+
+QString getDatasetsCatalogFilename() { return QStringLiteral("catalog.xml"); }
+
+QString getSpreadsheetsCacheDir()
+{
+    const QString cacheDirName{QStringLiteral("Cache")};
+    return getDatasetsDir() + cacheDirName + "/";
+}
+
+QString getSpillDir()
+{
+    const QString spillDirName{QStringLiteral("Spill")};
+    return getDatasetsDir() + spillDirName + "/";
+}
+
+void clearSpillDir()
+{
+    // Files still mapped by other running instance are either unlinked
+    // without invalidating mapping or locked and skipped, depending on OS.
+    QDir spillDir{getSpillDir()};
+    spillDir.setFilter(QDir::Files | QDir::NoDotAndDotDot);
+    spillDir.setNameFilters({QStringLiteral("*.spill")});
+    for (const QString& fileName : spillDir.entryList())
+        spillDir.remove(fileName);
+}
+
 QString getDatasetNameRegExp() { return QStringLiteral("[\\w\\s-]+"); }
 
 }  // namespace DatasetUtilities
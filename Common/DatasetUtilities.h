@@ -15,7 +15,7 @@ QStringList getListOfAvailableDatasets();
 /// Checks if default datasets directory can be used.
 bool doesDatasetDirExistAndUserHavePermisions();
 
-/// Removes given dataset from disk.
+/// Removes given dataset and its statistics cache from disk.
 bool removeDataset(const QString& datasetName);
 
 QString getDatasetDefinitionFilename();
@@ -24,7 +24,32 @@ QString getDatasetDataFilename();
 
 QString getDatasetStringsFilename();
 
+/// Name of block with validity bitmap and values of rows of column in
+/// COLUMNAR format.
+QString getDatasetColumnFilename(int column, int block);
+
+/// Name of block with zone map of column in COLUMNAR format.
+QString getDatasetZonesFilename(int column);
+
+/// Name of block with dictionary of string column in COLUMNAR format.
+QString getDatasetDictionaryFilename(int column);
+
 QString getDatasetExtension();
 
+/// Extension of statistics cache file kept next to dataset file.
+QString getDatasetStatisticsExtension();
+
+/// Name of file with metadata of all datasets in datasets dir.
+QString getDatasetsCatalogFilename();
+
+/// Directory with spreadsheets converted to .vbx files.
+QString getSpreadsheetsCacheDir();
+
+/// Directory with temporary files of columns paged out of memory.
+QString getSpillDir();
+
+/// Removes spill files left by sessions which did not exit cleanly.
+void clearSpillDir();
+
 QString getDatasetNameRegExp();
 };  // namespace DatasetUtilities
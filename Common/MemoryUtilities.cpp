@@ -0,0 +1,38 @@
+#include "MemoryUtilities.h"
+
+#ifdef Q_OS_WIN
+#include <windows.h>
+#else
+#include <QFile>
+#include <QTextStream>
+#endif
+
+namespace MemoryUtilities
+{
+quint64 getAvailableMemory()
+{
+#ifdef Q_OS_WIN
+    MEMORYSTATUSEX status;
+    status.dwLength = sizeof(status);
+    if (GlobalMemoryStatusEx(&status) == 0)
+        return 0;
+    return static_cast<quint64>(status.ullAvailPhys);
+#else
+    QFile file(QStringLiteral("/proc/meminfo"));
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+        return 0;
+
+    const quint64 bytesInKilobyte{1024};
+    QTextStream stream(&file);
+    QString line;
+    while (stream.readLineInto(&line))
+    {
+        if (!line.startsWith(QLatin1String("MemAvailable:")))
+            continue;
+        const QString value{line.section(' ', 1, 1, QString::SectionSkipEmpty)};
+        return value.toULongLong() * bytesInKilobyte;
+    }
+    return 0;
+#endif
+}
+}  // namespace MemoryUtilities
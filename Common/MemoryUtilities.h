@@ -0,0 +1,15 @@
+#pragma once
+
+#include <QtGlobal>
+
+/**
+ * Functions related to system memory.
+ */
+namespace MemoryUtilities
+{
+/**
+ * @brief Get amount of memory which can be allocated without swapping.
+ * @return Number of bytes or 0 when it cannot be determined.
+ */
+quint64 getAvailableMemory();
+}  // namespace MemoryUtilities
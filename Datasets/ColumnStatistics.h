@@ -0,0 +1,28 @@
+#pragma once
+
+#include <QDate>
+#include <QStringList>
+
+/**
+ * @brief Statistics of single column collected while data is loaded.
+ * Minimum and maximum are computed using not null values only.
+ */
+struct ColumnStatistics
+{
+public:
+    double minNumber_{0.};
+
+    double maxNumber_{0.};
+
+    QDate minDate_;
+
+    QDate maxDate_;
+
+    unsigned int nullCount_{0};
+
+    /// Number of distinct values, capped at 2 for NUMBER and DATE columns.
+    unsigned int distinctCount_{0};
+
+    /// Sorted distinct values of string column.
+    QStringList sortedStrings_;
+};
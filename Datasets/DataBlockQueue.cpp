@@ -0,0 +1,44 @@
+#include "DataBlockQueue.h"
+
+#include <utility>
+
+#include <QDeadlineTimer>
+
+DataBlockQueue::DataBlockQueue(int capacity) : capacity_(capacity) {}
+
+int DataBlockQueue::getCapacity() const { return capacity_; }
+
+bool DataBlockQueue::tryPush(DataBlock& block, int timeoutMs)
+{
+    const QDeadlineTimer deadline(timeoutMs);
+    const QMutexLocker locker(&mutex_);
+    while (blocks_.size() >= capacity_)
+        if (!notFull_.wait(&mutex_, deadline))
+            return false;
+
+    blocks_.enqueue(std::move(block));
+    notEmpty_.wakeOne();
+    return true;
+}
+
+bool DataBlockQueue::pop(DataBlock& block)
+{
+    const QMutexLocker locker(&mutex_);
+    while (blocks_.isEmpty())
+    {
+        if (closed_)
+            return false;
+        notEmpty_.wait(&mutex_);
+    }
+
+    block = blocks_.dequeue();
+    notFull_.wakeOne();
+    return true;
+}
+
+void DataBlockQueue::close()
+{
+    const QMutexLocker locker(&mutex_);
+    closed_ = true;
+    notEmpty_.wakeAll();
+}
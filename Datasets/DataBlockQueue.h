@@ -0,0 +1,61 @@
+#pragma once
+
+#include <QByteArray>
+#include <QMutex>
+#include <QQueue>
+#include <QWaitCondition>
+
+/**
+ * @brief Block of whole lines of data file starting at given row.
+ */
+struct DataBlock
+{
+    QByteArray bytes_;
+    unsigned int firstRow_{0};
+};
+
+/**
+ * @class DataBlockQueue
+ * @brief Bounded queue passing inflated blocks of data file from thread
+ * reading zip to threads parsing them. Thread-safe.
+ */
+class DataBlockQueue
+{
+public:
+    explicit DataBlockQueue(int capacity);
+
+    int getCapacity() const;
+
+    /**
+     * @brief Add block, waiting for free place when queue is full.
+     * @param block Block to add, moved when added.
+     * @param timeoutMs Maximum time of waiting.
+     * @return True if block was added, false on timeout.
+     */
+    bool tryPush(DataBlock& block, int timeoutMs);
+
+    /**
+     * @brief Take oldest block, waiting for it when queue is empty.
+     * @param block Taken block.
+     * @return True if block was taken, false when queue is closed and empty.
+     */
+    bool pop(DataBlock& block);
+
+    /**
+     * @brief Mark that no more blocks will be added and wake up consumers.
+     */
+    void close();
+
+private:
+    const int capacity_;
+
+    QQueue<DataBlock> blocks_;
+
+    bool closed_{false};
+
+    QMutex mutex_;
+
+    QWaitCondition notEmpty_;
+
+    QWaitCondition notFull_;
+};
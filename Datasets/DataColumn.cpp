@@ -0,0 +1,762 @@
+#include "DataColumn.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <QTemporaryFile>
+
+#include "StringInterner.h"
+
+DataColumn::DataColumn(ColumnType columnType, int rowCount,
+                       const QString& spillDirectory)
+    : columnType_(columnType), validity_(rowCount, false)
+{
+    if (!spillDirectory.isEmpty() && columnType_ != ColumnType::UNKNOWN)
+    {
+        // Codes can not be widened in file, so they are 4 bytes at once.
+        if (columnType_ == ColumnType::STRING)
+            codeWidth_ = CodeWidth::UINT32;
+        if (createSpillFile(spillDirectory))
+            return;
+        codeWidth_ = CodeWidth::UINT8;
+    }
+
+    switch (columnType_)
+    {
+        case ColumnType::NUMBER:
+            numbers_.resize(rowCount, 0.);
+            break;
+
+        case ColumnType::DATE:
+            julianDays_.resize(rowCount, 0);
+            break;
+
+        case ColumnType::STRING:
+            codes8_.resize(rowCount, 0);
+            break;
+
+        case ColumnType::UNKNOWN:
+            Q_ASSERT(false);
+            break;
+    }
+}
+
+qint64 DataColumn::getPlainValueSize(ColumnType columnType)
+{
+    switch (columnType)
+    {
+        case ColumnType::NUMBER:
+            return sizeof(double);
+        case ColumnType::DATE:
+            return sizeof(qint32);
+        case ColumnType::STRING:
+            return sizeof(quint32);
+        case ColumnType::UNKNOWN:
+            break;
+    }
+    return 0;
+}
+
+ColumnType DataColumn::getColumnType() const { return columnType_; }
+
+int DataColumn::rowCount() const { return static_cast<int>(validity_.size()); }
+
+const QBitArray& DataColumn::getValidity() const { return validity_; }
+
+const QStringList& DataColumn::getDictionary() const { return dictionary_; }
+
+int DataColumn::getCodeWidth() const
+{
+    switch (codeWidth_)
+    {
+        case CodeWidth::UINT8:
+            return sizeof(quint8);
+        case CodeWidth::UINT16:
+            return sizeof(quint16);
+        case CodeWidth::UINT32:
+            return sizeof(quint32);
+    }
+    return sizeof(quint32);
+}
+
+void DataColumn::setNumber(int row, double value)
+{
+    Q_ASSERT(columnType_ == ColumnType::NUMBER);
+    Q_ASSERT(encoding_ == Encoding::PLAIN);
+    writeValue(numbers_, row, value);
+    validity_.setBit(row);
+    updateNumericRange(value);
+}
+
+void DataColumn::setJulianDay(int row, int julianDay)
+{
+    Q_ASSERT(columnType_ == ColumnType::DATE);
+    Q_ASSERT(encoding_ == Encoding::PLAIN);
+    writeValue(julianDays_, row, static_cast<qint32>(julianDay));
+    validity_.setBit(row);
+    updateDateRange(julianDay);
+}
+
+quint32 DataColumn::addToDictionary(const QString& value)
+{
+    Q_ASSERT(columnType_ == ColumnType::STRING);
+    auto it{dictionaryCodes_.constFind(value)};
+    if (it != dictionaryCodes_.constEnd())
+        return it.value();
+
+    const auto code{static_cast<quint32>(dictionary_.size())};
+    dictionary_.append(value);
+    dictionaryCodes_.insert(value, code);
+
+    if ((codeWidth_ == CodeWidth::UINT8 &&
+         code > std::numeric_limits<quint8>::max()) ||
+        (codeWidth_ == CodeWidth::UINT16 &&
+         code > std::numeric_limits<quint16>::max()))
+        widenCodes();
+
+    return code;
+}
+
+void DataColumn::setStringCode(int row, quint32 code)
+{
+    Q_ASSERT(columnType_ == ColumnType::STRING);
+    Q_ASSERT(code < static_cast<quint32>(dictionary_.size()));
+    writeCode(row, code);
+    validity_.setBit(row);
+}
+
+void DataColumn::writeCode(int row, quint32 code)
+{
+    Q_ASSERT(encoding_ == Encoding::PLAIN);
+    switch (codeWidth_)
+    {
+        case CodeWidth::UINT8:
+            writeValue(codes8_, row, static_cast<quint8>(code));
+            break;
+        case CodeWidth::UINT16:
+            writeValue(codes16_, row, static_cast<quint16>(code));
+            break;
+        case CodeWidth::UINT32:
+            writeValue(codes32_, row, code);
+            break;
+    }
+}
+
+void DataColumn::setString(int row, const QString& value)
+{
+    setStringCode(row, addToDictionary(value));
+}
+
+void DataColumn::setNull(int row)
+{
+    Q_ASSERT(encoding_ == Encoding::PLAIN);
+    switch (columnType_)
+    {
+        case ColumnType::NUMBER:
+            writeValue(numbers_, row, 0.);
+            break;
+
+        case ColumnType::DATE:
+            writeValue(julianDays_, row, 0);
+            break;
+
+        case ColumnType::STRING:
+            writeCode(row, 0);
+            break;
+
+        case ColumnType::UNKNOWN:
+            break;
+    }
+    validity_.clearBit(row);
+}
+
+void DataColumn::setNumbers(QVector<double> numbers, QBitArray validity)
+{
+    Q_ASSERT(columnType_ == ColumnType::NUMBER);
+    Q_ASSERT(encoding_ == Encoding::PLAIN);
+    Q_ASSERT(numbers.size() == rowCount() && validity.size() == rowCount());
+    if (isSpilled())
+        std::copy(numbers.cbegin(), numbers.cend(),
+                  reinterpret_cast<double*>(spilledValues_));
+    else
+        numbers_ = std::move(numbers);
+    setValidity(std::move(validity));
+}
+
+void DataColumn::setJulianDays(QVector<qint32> julianDays, QBitArray validity)
+{
+    Q_ASSERT(columnType_ == ColumnType::DATE);
+    Q_ASSERT(encoding_ == Encoding::PLAIN);
+    Q_ASSERT(julianDays.size() == rowCount() &&
+             validity.size() == rowCount());
+    if (isSpilled())
+        std::copy(julianDays.cbegin(), julianDays.cend(),
+                  reinterpret_cast<qint32*>(spilledValues_));
+    else
+        julianDays_ = std::move(julianDays);
+    setValidity(std::move(validity));
+}
+
+char* DataColumn::getValuesForFilling()
+{
+    Q_ASSERT(encoding_ == Encoding::PLAIN);
+    if (isSpilled())
+        return reinterpret_cast<char*>(spilledValues_);
+
+    switch (columnType_)
+    {
+        case ColumnType::NUMBER:
+            return reinterpret_cast<char*>(numbers_.data());
+
+        case ColumnType::DATE:
+            return reinterpret_cast<char*>(julianDays_.data());
+
+        case ColumnType::STRING:
+            if (codeWidth_ == CodeWidth::UINT32)
+                return reinterpret_cast<char*>(codes32_.data());
+            break;
+
+        case ColumnType::UNKNOWN:
+            break;
+    }
+    return nullptr;
+}
+
+void DataColumn::setValidity(QBitArray validity)
+{
+    Q_ASSERT(columnType_ == ColumnType::NUMBER ||
+             columnType_ == ColumnType::DATE);
+    Q_ASSERT(validity.size() == rowCount());
+    validity_ = std::move(validity);
+    updateRanges();
+}
+
+void DataColumn::updateRanges()
+{
+    for (int row = 0; row < rowCount(); ++row)
+    {
+        if (isNull(row))
+            continue;
+        if (columnType_ == ColumnType::NUMBER)
+            updateNumericRange(valueAt(numbers_, row));
+        else
+            updateDateRange(valueAt(julianDays_, row));
+    }
+}
+
+void DataColumn::setStrings(QStringList dictionary, const quint32* codes,
+                            QBitArray validity)
+{
+    Q_ASSERT(columnType_ == ColumnType::STRING);
+    Q_ASSERT(dictionary_.isEmpty());
+    Q_ASSERT(validity.size() == rowCount());
+    const auto dictionarySize{static_cast<quint32>(dictionary.size())};
+    dictionary_ = std::move(dictionary);
+    validity_ = std::move(validity);
+    while ((codeWidth_ == CodeWidth::UINT8 &&
+            dictionarySize > std::numeric_limits<quint8>::max() + 1U) ||
+           (codeWidth_ == CodeWidth::UINT16 &&
+            dictionarySize > std::numeric_limits<quint16>::max() + 1U))
+        widenCodes();
+
+    for (int row = 0; row < rowCount(); ++row)
+    {
+        if (isNull(row))
+            continue;
+        Q_ASSERT(codes[row] < dictionarySize);
+        writeCode(row, codes[row]);
+    }
+}
+
+void DataColumn::finishFilling()
+{
+    releaseFillingData();
+    if (columnType_ == ColumnType::STRING)
+    {
+        statistics_.sortedStrings_ = dictionary_;
+        statistics_.sortedStrings_.sort();
+    }
+    computeDistinctCount();
+    encodeValues();
+}
+
+bool DataColumn::finishFilling(unsigned int distinctCount,
+                               const QVector<quint32>& sortedCodes)
+{
+    if (columnType_ == ColumnType::STRING)
+    {
+        const auto dictionarySize{static_cast<quint32>(dictionary_.size())};
+        QBitArray usedCodes(dictionary_.size());
+        for (const quint32 code : sortedCodes)
+        {
+            if (code >= dictionarySize || usedCodes.testBit(code))
+                break;
+            usedCodes.setBit(code);
+        }
+        if (sortedCodes.size() != dictionary_.size() ||
+            usedCodes.count(true) != dictionary_.size())
+        {
+            finishFilling();
+            return false;
+        }
+    }
+
+    releaseFillingData();
+    if (columnType_ == ColumnType::STRING)
+    {
+        statistics_.sortedStrings_.reserve(dictionary_.size());
+        for (const quint32 code : sortedCodes)
+            statistics_.sortedStrings_.append(dictionary_[code]);
+    }
+    statistics_.distinctCount_ = distinctCount;
+    encodeValues();
+    return true;
+}
+
+QVector<quint32> DataColumn::getSortedCodes() const
+{
+    if (columnType_ != ColumnType::STRING)
+        return {};
+
+    QHash<QString, quint32> codes;
+    codes.reserve(dictionary_.size());
+    for (qsizetype code = 0; code < dictionary_.size(); ++code)
+        codes.insert(dictionary_[code], static_cast<quint32>(code));
+    QVector<quint32> sortedCodes;
+    sortedCodes.reserve(statistics_.sortedStrings_.size());
+    for (const QString& string : statistics_.sortedStrings_)
+        sortedCodes.append(codes.value(string));
+    return sortedCodes;
+}
+
+void DataColumn::releaseFillingData()
+{
+    dictionaryCodes_.clear();
+    dictionaryCodes_.squeeze();
+    dictionary_.squeeze();
+
+    statistics_.nullCount_ =
+        static_cast<unsigned int>(rowCount() - validity_.count(true));
+    if (columnType_ == ColumnType::DATE && rangeInitialized_)
+    {
+        statistics_.minDate_ = QDate::fromJulianDay(minJulianDay_);
+        statistics_.maxDate_ = QDate::fromJulianDay(maxJulianDay_);
+    }
+    if (columnType_ == ColumnType::STRING)
+        internDictionary();
+}
+
+void DataColumn::internDictionary()
+{
+    if (internedStrings_ != nullptr)
+        return;
+
+    StringInterner::getInstance().intern(dictionary_);
+    internedStrings_ = std::shared_ptr<QStringList>(
+        new QStringList(dictionary_),
+        [](QStringList* strings)
+        {
+            StringInterner::getInstance().release(*strings);
+            delete strings;
+        });
+}
+
+DataColumn::Encoding DataColumn::getEncoding() const { return encoding_; }
+
+QString DataColumn::getEncodingName() const
+{
+    if (columnType_ == ColumnType::STRING)
+        return "dictionary (" + QString::number(getCodeWidth()) +
+               " byte codes)";
+
+    switch (encoding_)
+    {
+        case Encoding::PLAIN:
+            return QStringLiteral("plain");
+        case Encoding::FRAME_OF_REFERENCE:
+            return QStringLiteral("frame of reference");
+        case Encoding::SCALED_INTEGER:
+            return "scaled integer (x" + QString::number(scale_) + ")";
+        case Encoding::FLOAT32:
+            return QStringLiteral("float32");
+        case Encoding::RUN_LENGTH:
+            return QStringLiteral("run-length");
+    }
+    return {};
+}
+
+const ColumnStatistics& DataColumn::getStatistics() const
+{
+    return statistics_;
+}
+
+quint64 DataColumn::getMemoryUsage() const
+{
+    return getValuesMemoryUsage() + getDictionaryMemoryUsage();
+}
+
+quint64 DataColumn::getValuesMemoryUsage() const
+{
+    const quint64 bitsInByte{8};
+    const auto validityBits{static_cast<quint64>(validity_.size())};
+    return static_cast<quint64>(numbers_.capacity()) * sizeof(double) +
+           static_cast<quint64>(julianDays_.capacity()) * sizeof(qint32) +
+           static_cast<quint64>(codes8_.capacity()) * sizeof(quint8) +
+           static_cast<quint64>(codes16_.capacity()) * sizeof(quint16) +
+           static_cast<quint64>(codes32_.capacity()) * sizeof(quint32) +
+           static_cast<quint64>(dayOffsets_.capacity()) * sizeof(quint16) +
+           static_cast<quint64>(scaledNumbers_.capacity()) * sizeof(qint32) +
+           static_cast<quint64>(floatNumbers_.capacity()) * sizeof(float) +
+           static_cast<quint64>(runStarts_.capacity()) * sizeof(qint32) +
+           static_cast<quint64>(runValues_.capacity()) * sizeof(double) +
+           (validityBits + bitsInByte - 1) / bitsInByte;
+}
+
+quint64 DataColumn::getDictionaryMemoryUsage() const
+{
+    const quint64 listsMemory{
+        static_cast<quint64>(dictionary_.capacity() +
+                             statistics_.sortedStrings_.capacity()) *
+        sizeof(QString)};
+
+    // Interned strings are shared with other columns and tabs, count only
+    // part of them falling on this column.
+    if (internedStrings_ != nullptr)
+        return listsMemory +
+               StringInterner::getInstance().getMemoryShare(*internedStrings_);
+
+    quint64 stringsMemory{0};
+    for (const auto& string : dictionary_)
+        stringsMemory +=
+            static_cast<quint64>(string.capacity()) * sizeof(QChar);
+    return listsMemory + stringsMemory;
+}
+
+bool DataColumn::spill(const QString& directory)
+{
+    if (isSpilled())
+        return true;
+
+    const auto [values, size] = getValuesBuffer();
+    if (size == 0)
+        return false;
+
+    auto file{std::make_shared<QTemporaryFile>(
+        directory + QStringLiteral("XXXXXX.spill"))};
+    if (!file->open() || file->write(values, size) != size || !file->flush())
+        return false;
+
+    uchar* mapped{file->map(0, size)};
+    if (mapped == nullptr)
+        return false;
+
+    spillFile_ = std::move(file);
+    spilledValues_ = mapped;
+    spilledSize_ = size;
+    numbers_ = {};
+    julianDays_ = {};
+    codes8_ = {};
+    codes16_ = {};
+    codes32_ = {};
+    dayOffsets_ = {};
+    scaledNumbers_ = {};
+    floatNumbers_ = {};
+    return true;
+}
+
+bool DataColumn::isSpilled() const { return spilledValues_ != nullptr; }
+
+bool DataColumn::createSpillFile(const QString& directory)
+{
+    const qint64 size{static_cast<qint64>(rowCount()) *
+                      getPlainValueSize(columnType_)};
+    auto file{std::make_shared<QTemporaryFile>(
+        directory + QStringLiteral("XXXXXX.spill"))};
+
+    // Extended file reads as zeros, same as null rows of new column.
+    if (size == 0 || !file->open() || !file->resize(size))
+        return false;
+
+    uchar* mapped{file->map(0, size)};
+    if (mapped == nullptr)
+        return false;
+
+    spillFile_ = std::move(file);
+    spilledValues_ = mapped;
+    spilledSize_ = size;
+    return true;
+}
+
+quint64 DataColumn::getSpilledSize() const
+{
+    return static_cast<quint64>(spilledSize_);
+}
+
+std::pair<const char*, qint64> DataColumn::getValuesBuffer() const
+{
+    const auto rows{static_cast<qint64>(rowCount())};
+    switch (encoding_)
+    {
+        case Encoding::PLAIN:
+            break;
+        case Encoding::FRAME_OF_REFERENCE:
+            return {reinterpret_cast<const char*>(dayOffsets_.constData()),
+                    rows * static_cast<qint64>(sizeof(quint16))};
+        case Encoding::SCALED_INTEGER:
+            return {reinterpret_cast<const char*>(scaledNumbers_.constData()),
+                    rows * static_cast<qint64>(sizeof(qint32))};
+        case Encoding::FLOAT32:
+            return {reinterpret_cast<const char*>(floatNumbers_.constData()),
+                    rows * static_cast<qint64>(sizeof(float))};
+        case Encoding::RUN_LENGTH:
+            // Runs are small enough to stay in memory.
+            return {nullptr, 0};
+    }
+
+    switch (columnType_)
+    {
+        case ColumnType::NUMBER:
+            return {reinterpret_cast<const char*>(numbers_.constData()),
+                    rows * static_cast<qint64>(sizeof(double))};
+
+        case ColumnType::DATE:
+            return {reinterpret_cast<const char*>(julianDays_.constData()),
+                    rows * static_cast<qint64>(sizeof(qint32))};
+
+        case ColumnType::STRING:
+            break;
+
+        case ColumnType::UNKNOWN:
+            return {nullptr, 0};
+    }
+
+    switch (codeWidth_)
+    {
+        case CodeWidth::UINT8:
+            return {reinterpret_cast<const char*>(codes8_.constData()),
+                    rows * static_cast<qint64>(sizeof(quint8))};
+        case CodeWidth::UINT16:
+            return {reinterpret_cast<const char*>(codes16_.constData()),
+                    rows * static_cast<qint64>(sizeof(quint16))};
+        case CodeWidth::UINT32:
+            return {reinterpret_cast<const char*>(codes32_.constData()),
+                    rows * static_cast<qint64>(sizeof(quint32))};
+    }
+    return {nullptr, 0};
+}
+
+void DataColumn::widenCodes()
+{
+    Q_ASSERT(!isSpilled());
+    const int rows{rowCount()};
+    if (codeWidth_ == CodeWidth::UINT8)
+    {
+        codes16_.resize(rows);
+        for (int row = 0; row < rows; ++row)
+            codes16_[row] = codes8_[row];
+        codes8_ = {};
+        codeWidth_ = CodeWidth::UINT16;
+        return;
+    }
+
+    codes32_.resize(rows);
+    for (int row = 0; row < rows; ++row)
+        codes32_[row] = codes16_[row];
+    codes16_ = {};
+    codeWidth_ = CodeWidth::UINT32;
+}
+
+void DataColumn::updateNumericRange(double value)
+{
+    if (!rangeInitialized_)
+    {
+        statistics_.minNumber_ = value;
+        statistics_.maxNumber_ = value;
+        rangeInitialized_ = true;
+        return;
+    }
+
+    statistics_.minNumber_ = std::min(statistics_.minNumber_, value);
+    statistics_.maxNumber_ = std::max(statistics_.maxNumber_, value);
+}
+
+void DataColumn::updateDateRange(int julianDay)
+{
+    if (!rangeInitialized_)
+    {
+        minJulianDay_ = julianDay;
+        maxJulianDay_ = julianDay;
+        rangeInitialized_ = true;
+        return;
+    }
+
+    minJulianDay_ = std::min(minJulianDay_, julianDay);
+    maxJulianDay_ = std::max(maxJulianDay_, julianDay);
+}
+
+void DataColumn::computeDistinctCount()
+{
+    if (columnType_ == ColumnType::STRING)
+    {
+        statistics_.distinctCount_ =
+            static_cast<unsigned int>(dictionary_.size());
+        return;
+    }
+
+    // Filters only need to know if column has more than one value, so
+    // range collected while filling is enough instead of sorting values.
+    if (!rangeInitialized_)
+    {
+        statistics_.distinctCount_ = 0;
+        return;
+    }
+    const bool singleValue{
+        columnType_ == ColumnType::NUMBER
+            ? statistics_.minNumber_ == statistics_.maxNumber_
+            : minJulianDay_ == maxJulianDay_};
+    statistics_.distinctCount_ = singleValue ? 1 : 2;
+}
+
+void DataColumn::encodeValues()
+{
+    // Encodings save memory, values kept in spill file stay plain.
+    if ((columnType_ != ColumnType::NUMBER &&
+         columnType_ != ColumnType::DATE) ||
+        isSpilled())
+        return;
+
+    const auto rows{static_cast<quint64>(rowCount())};
+    const quint64 plainSize{
+        rows * (columnType_ == ColumnType::NUMBER ? sizeof(double)
+                                                  : sizeof(qint32))};
+    const quint64 runs{countRuns()};
+    if (runs < rows / MIN_AVERAGE_RUN_LENGTH)
+    {
+        encodeRunLength();
+        return;
+    }
+
+    // Otherwise run length is used only when nothing else saves memory.
+    const quint64 runLengthSize{runs * (sizeof(qint32) + sizeof(double))};
+
+    if (columnType_ == ColumnType::DATE)
+    {
+        if (!encodeDatesUsingFrameOfReference() && runLengthSize < plainSize)
+            encodeRunLength();
+        return;
+    }
+
+    if (!encodeScaledNumbers() && !encodeFloatNumbers() &&
+        runLengthSize < plainSize)
+        encodeRunLength();
+}
+
+quint64 DataColumn::countRuns() const
+{
+    const int rows{rowCount()};
+    if (rows == 0)
+        return 0;
+
+    quint64 runs{1};
+    for (int row = 1; row < rows; ++row)
+    {
+        const bool sameValue{columnType_ == ColumnType::NUMBER
+                                 ? numbers_[row] == numbers_[row - 1]
+                                 : julianDays_[row] == julianDays_[row - 1]};
+        if (!sameValue)
+            ++runs;
+    }
+    return runs;
+}
+
+void DataColumn::encodeRunLength()
+{
+    const int rows{rowCount()};
+    for (int row = 0; row < rows; ++row)
+    {
+        const double value{columnType_ == ColumnType::NUMBER
+                               ? numbers_[row]
+                               : static_cast<double>(julianDays_[row])};
+        if (!runValues_.isEmpty() && runValues_.constLast() == value)
+            continue;
+        runStarts_.append(row);
+        runValues_.append(value);
+    }
+    runStarts_.squeeze();
+    runValues_.squeeze();
+    numbers_ = {};
+    julianDays_ = {};
+    encoding_ = Encoding::RUN_LENGTH;
+}
+
+bool DataColumn::encodeDatesUsingFrameOfReference()
+{
+    if (!rangeInitialized_ ||
+        maxJulianDay_ - minJulianDay_ > std::numeric_limits<quint16>::max())
+        return false;
+
+    const int rows{rowCount()};
+    reference_ = minJulianDay_;
+    dayOffsets_.resize(rows);
+    for (int row = 0; row < rows; ++row)
+        dayOffsets_[row] = isNull(row) ? 0
+                                       : static_cast<quint16>(
+                                             julianDays_[row] - reference_);
+    julianDays_ = {};
+    encoding_ = Encoding::FRAME_OF_REFERENCE;
+    return true;
+}
+
+bool DataColumn::encodeScaledNumbers()
+{
+    // Smallest power of 10 which turns all numbers into integers.
+    const int maxDecimals{4};
+    int decimals{0};
+    double scale{1.};
+    const double maxScaled{std::numeric_limits<qint32>::max()};
+    for (const double number : numbers_)
+    {
+        while (std::abs(number * scale) > maxScaled ||
+               static_cast<double>(std::llround(number * scale)) / scale !=
+                   number)
+        {
+            if (decimals == maxDecimals ||
+                std::abs(number * scale) > maxScaled)
+                return false;
+            ++decimals;
+            scale *= 10.;
+        }
+    }
+
+    const int rows{rowCount()};
+    QVector<qint32> scaledNumbers(rows);
+    for (int row = 0; row < rows; ++row)
+    {
+        scaledNumbers[row] =
+            static_cast<qint32>(std::llround(numbers_[row] * scale));
+        if (static_cast<double>(scaledNumbers[row]) / scale != numbers_[row])
+            return false;
+    }
+
+    scale_ = scale;
+    scaledNumbers_ = std::move(scaledNumbers);
+    numbers_ = {};
+    encoding_ = Encoding::SCALED_INTEGER;
+    return true;
+}
+
+bool DataColumn::encodeFloatNumbers()
+{
+    for (const double number : numbers_)
+        if (static_cast<double>(static_cast<float>(number)) != number)
+            return false;
+
+    const int rows{rowCount()};
+    floatNumbers_.resize(rows);
+    for (int row = 0; row < rows; ++row)
+        floatNumbers_[row] = static_cast<float>(numbers_[row]);
+    numbers_ = {};
+    encoding_ = Encoding::FLOAT32;
+    return true;
+}
@@ -0,0 +1,445 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+
+#include <ColumnType.h>
+#include <QBitArray>
+#include <QHash>
+#include <QStringList>
+#include <QVector>
+
+#include "ColumnStatistics.h"
+
+class QFile;
+
+/**
+ * @class DataColumn
+ * @brief Column-major storage of single dataset column.
+ * Numbers are kept as doubles, dates as Julian days and strings as codes into
+ * column dictionary. Width of string codes (1, 2 or 4 bytes) grows with
+ * dictionary size. Validity bitmap marks which rows are not null.
+ * Values of filled NUMBER and DATE columns are encoded using compact lossless
+ * encoding with direct access to rows, run length only for long runs. Values can be kept in memory-mapped spill file from the
+ * start, so they never occupy heap, or spilled to such file after filling.
+ * Dictionary of filled STRING column is shared with other columns using
+ * StringInterner.
+ */
+class DataColumn
+{
+public:
+    /// Encoding of values of NUMBER and DATE columns.
+    enum class Encoding : unsigned char
+    {
+        PLAIN,
+        FRAME_OF_REFERENCE,
+        SCALED_INTEGER,
+        FLOAT32,
+        RUN_LENGTH
+    };
+
+    /**
+     * @brief DataColumn constructor.
+     * @param columnType Type of column.
+     * @param rowCount Number of rows to allocate, all initially null.
+     * @param spillDirectory Directory of spill file backing values, empty to
+     * keep values in memory. Values are kept in memory when file can not be
+     * created, which can be checked using isSpilled().
+     */
+    DataColumn(ColumnType columnType, int rowCount,
+               const QString& spillDirectory = {});
+
+    /**
+     * @brief Get number of bytes of single value kept without encoding.
+     * Codes of strings are counted as 4 bytes.
+     * @param columnType Type of column.
+     * @return Number of bytes.
+     */
+    static qint64 getPlainValueSize(ColumnType columnType);
+
+    /**
+     * @brief Get type of column.
+     * @return Column type.
+     */
+    ColumnType getColumnType() const;
+
+    /**
+     * @brief Get number of rows in column.
+     * @return Number of rows.
+     */
+    int rowCount() const;
+
+    /**
+     * @brief Check if value in given row is null.
+     * @param row Row index.
+     * @return True if null, false otherwise.
+     */
+    inline bool isNull(int row) const { return !validity_.testBit(row); }
+
+    /**
+     * @brief Get validity bitmap with bits set for not null rows.
+     * @return Validity bitmap.
+     */
+    const QBitArray& getValidity() const;
+
+    /**
+     * @brief Get number stored in given row. Null rows return 0.
+     * @param row Row index.
+     * @return Number.
+     */
+    inline double getNumber(int row) const
+    {
+        switch (encoding_)
+        {
+            case Encoding::PLAIN:
+                return valueAt(numbers_, row);
+            case Encoding::SCALED_INTEGER:
+                return static_cast<double>(valueAt(scaledNumbers_, row)) /
+                       scale_;
+            case Encoding::FLOAT32:
+                return static_cast<double>(valueAt(floatNumbers_, row));
+            case Encoding::RUN_LENGTH:
+                return getRunValue(row);
+            case Encoding::FRAME_OF_REFERENCE:
+                break;
+        }
+        return 0.;
+    }
+
+    /**
+     * @brief Get Julian day stored in given row. Null rows return 0.
+     * @param row Row index.
+     * @return Julian day.
+     */
+    inline int getJulianDay(int row) const
+    {
+        switch (encoding_)
+        {
+            case Encoding::PLAIN:
+                return valueAt(julianDays_, row);
+            case Encoding::FRAME_OF_REFERENCE:
+                return isNull(row)
+                           ? 0
+                           : reference_ + valueAt(dayOffsets_, row);
+            case Encoding::RUN_LENGTH:
+                return static_cast<int>(getRunValue(row));
+            case Encoding::SCALED_INTEGER:
+            case Encoding::FLOAT32:
+                break;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Get dictionary code of string stored in given row.
+     * @param row Row index.
+     * @return String code.
+     */
+    inline quint32 getStringCode(int row) const
+    {
+        switch (codeWidth_)
+        {
+            case CodeWidth::UINT8:
+                return valueAt(codes8_, row);
+            case CodeWidth::UINT16:
+                return valueAt(codes16_, row);
+            case CodeWidth::UINT32:
+                return valueAt(codes32_, row);
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Get string stored in given row.
+     * @param row Row index.
+     * @return String.
+     */
+    inline const QString& getString(int row) const
+    {
+        return dictionary_[static_cast<qsizetype>(getStringCode(row))];
+    }
+
+    /**
+     * @brief Get dictionary of string column. Strings are in order of first
+     * appearance.
+     * @return Dictionary.
+     */
+    const QStringList& getDictionary() const;
+
+    /**
+     * @brief Get number of bytes used by single string code.
+     * @return Code width in bytes.
+     */
+    int getCodeWidth() const;
+
+    void setNumber(int row, double value);
+
+    void setJulianDay(int row, int julianDay);
+
+    /**
+     * @brief Add string to dictionary if needed.
+     * @param value String.
+     * @return Dictionary code of string.
+     */
+    quint32 addToDictionary(const QString& value);
+
+    void setStringCode(int row, quint32 code);
+
+    void setString(int row, const QString& value);
+
+    void setNull(int row);
+
+    /**
+     * @brief Set all values of NUMBER column at once.
+     * @param numbers Numbers, 0 for null rows.
+     * @param validity Bitmap with bits set for not null rows.
+     */
+    void setNumbers(QVector<double> numbers, QBitArray validity);
+
+    /**
+     * @brief Set all values of DATE column at once.
+     * @param julianDays Julian days, 0 for null rows.
+     * @param validity Bitmap with bits set for not null rows.
+     */
+    void setJulianDays(QVector<qint32> julianDays, QBitArray validity);
+
+    /**
+     * @brief Set dictionary and all codes of STRING column at once.
+     * @param dictionary Dictionary of column.
+     * @param codes Codes into dictionary for each row, ignored for null
+     * rows. Can point to memory returned by getValuesForFilling().
+     * @param validity Bitmap with bits set for not null rows.
+     */
+    void setStrings(QStringList dictionary, const quint32* codes,
+                    QBitArray validity);
+
+    /**
+     * @brief Get memory of plain values of all rows, for filling them at
+     * once in place. For STRING column it is available only when codes are
+     * 4 bytes wide, which is always the case for spilled column.
+     * @return Doubles, Julian days or 4 byte codes, nullptr if not available.
+     */
+    char* getValuesForFilling();
+
+    /**
+     * @brief Set validity of NUMBER or DATE column filled in place using
+     * getValuesForFilling().
+     * @param validity Bitmap with bits set for not null rows.
+     */
+    void setValidity(QBitArray validity);
+
+    /**
+     * @brief Complete statistics and release helper structures used only
+     * during filling of column.
+     */
+    void finishFilling();
+
+    /**
+     * @brief Complete filling reusing statistics computed by earlier load of
+     * the same data instead of computing them again.
+     * @param distinctCount Number of distinct values.
+     * @param sortedCodes Dictionary codes in order of sorted strings, used
+     * for STRING column only.
+     * @return False when sorted codes do not fit dictionary and statistics
+     * were computed, true otherwise.
+     */
+    bool finishFilling(unsigned int distinctCount,
+                       const QVector<quint32>& sortedCodes);
+
+    /**
+     * @brief Get dictionary codes in order of sorted strings.
+     * @return Codes, empty for other columns than STRING.
+     */
+    QVector<quint32> getSortedCodes() const;
+
+    /**
+     * @brief Get encoding of values chosen when filling was finished.
+     * @return Encoding.
+     */
+    Encoding getEncoding() const;
+
+    /**
+     * @brief Get name of encoding of values.
+     * @return Encoding name.
+     */
+    QString getEncodingName() const;
+
+    /**
+     * @brief Get statistics of column. Valid after filling is finished.
+     * @return Column statistics.
+     */
+    const ColumnStatistics& getStatistics() const;
+
+    /**
+     * @brief Get number of bytes allocated for values, dictionary and
+     * validity bitmap.
+     * @return Number of bytes.
+     */
+    quint64 getMemoryUsage() const;
+
+    /**
+     * @brief Get number of bytes allocated for values and validity bitmap.
+     * @return Number of bytes.
+     */
+    quint64 getValuesMemoryUsage() const;
+
+    /**
+     * @brief Get number of bytes allocated for dictionary and sorted strings.
+     * Strings shared using StringInterner are counted proportionally to
+     * number of their users.
+     * @return Number of bytes.
+     */
+    quint64 getDictionaryMemoryUsage() const;
+
+    /**
+     * @brief Move values of filled column into memory-mapped temporary file
+     * and release them from memory. Validity bitmap and dictionary are kept
+     * in memory. File is removed when last copy of column is destroyed.
+     * Column created with spill directory is spilled already.
+     * @param directory Directory in which file is created.
+     * @return True if values were spilled, false otherwise.
+     */
+    bool spill(const QString& directory);
+
+    /**
+     * @brief Check if values are kept in memory-mapped file.
+     * @return True if spilled, false otherwise.
+     */
+    bool isSpilled() const;
+
+    /**
+     * @brief Get number of bytes of values placed in spill file.
+     * @return Number of bytes.
+     */
+    quint64 getSpilledSize() const;
+
+private:
+    enum class CodeWidth : unsigned char
+    {
+        UINT8,
+        UINT16,
+        UINT32
+    };
+
+    template <typename T>
+    inline T valueAt(const QVector<T>& values, int row) const
+    {
+        if (spilledValues_ != nullptr)
+            return reinterpret_cast<const T*>(spilledValues_)[row];
+        return values[row];
+    }
+
+    template <typename T>
+    inline void writeValue(QVector<T>& values, int row, T value)
+    {
+        if (spilledValues_ != nullptr)
+            reinterpret_cast<T*>(spilledValues_)[row] = value;
+        else
+            values[row] = value;
+    }
+
+    bool createSpillFile(const QString& directory);
+
+    void updateRanges();
+
+    inline double getRunValue(int row) const
+    {
+        const auto it{
+            std::upper_bound(runStarts_.cbegin(), runStarts_.cend(), row)};
+        return runValues_[static_cast<qsizetype>(it - runStarts_.cbegin()) -
+                          1];
+    }
+
+    std::pair<const char*, qint64> getValuesBuffer() const;
+
+    void encodeValues();
+
+    quint64 countRuns() const;
+
+    void encodeRunLength();
+
+    bool encodeDatesUsingFrameOfReference();
+
+    bool encodeScaledNumbers();
+
+    bool encodeFloatNumbers();
+
+    void writeCode(int row, quint32 code);
+
+    void widenCodes();
+
+    void updateNumericRange(double value);
+
+    void updateDateRange(int julianDay);
+
+    void computeDistinctCount();
+
+    void internDictionary();
+
+    void releaseFillingData();
+
+    ColumnType columnType_;
+
+    /// Values of NUMBER column.
+    QVector<double> numbers_;
+
+    /// Julian days of DATE column.
+    QVector<qint32> julianDays_;
+
+    /// Codes of STRING column, only one of them is used.
+    QVector<quint8> codes8_;
+    QVector<quint16> codes16_;
+    QVector<quint32> codes32_;
+
+    CodeWidth codeWidth_{CodeWidth::UINT8};
+
+    Encoding encoding_{Encoding::PLAIN};
+
+    /// Offsets of Julian days from reference_ for FRAME_OF_REFERENCE.
+    QVector<quint16> dayOffsets_;
+    qint32 reference_{0};
+
+    /// Numbers multiplied by scale_ for SCALED_INTEGER.
+    QVector<qint32> scaledNumbers_;
+    double scale_{1.};
+
+    /// Numbers for FLOAT32.
+    QVector<float> floatNumbers_;
+
+    /// First rows and values of runs for RUN_LENGTH.
+    QVector<qint32> runStarts_;
+    QVector<double> runValues_;
+
+    /// Reading row of RUN_LENGTH needs binary search over runs, so it is
+    /// preferred over other encodings only for runs this long on average.
+    static constexpr quint64 MIN_AVERAGE_RUN_LENGTH{64};
+
+    QStringList dictionary_;
+
+    /// Lookup of codes used while column is filled.
+    QHash<QString, quint32> dictionaryCodes_;
+
+    /// Bit set for each not null row.
+    QBitArray validity_;
+
+    ColumnStatistics statistics_;
+
+    /// Flag indicating that range in statistics_ got first value.
+    bool rangeInitialized_{false};
+
+    int minJulianDay_{0};
+
+    int maxJulianDay_{0};
+
+    /// Dictionary strings taken from StringInterner, released when last copy
+    /// of column is destroyed.
+    std::shared_ptr<QStringList> internedStrings_;
+
+    /// File with spilled values shared by copies of column.
+    std::shared_ptr<QFile> spillFile_;
+
+    /// Mapped values when column is spilled, nullptr otherwise.
+    uchar* spilledValues_{nullptr};
+
+    qint64 spilledSize_{0};
+};
@@ -1,14 +1,22 @@
 #include "Dataset.h"
 
+#include <algorithm>
+#include <utility>
+
 #include <QDate>
+#include <QDir>
 #include <QDomDocument>
+#include <QHash>
+#include <QSet>
+#include <QThread>
 
 #include <Constants.h>
+#include <Logger.h>
+
+#include "StringInterner.h"
 
 Dataset::Dataset(QString name, QObject* parent)
-    : QObject(parent),
-      nullStringVariant_(QMetaType(QMetaType::QString)),
-      name_(std::move(name))
+    : QObject(parent), name_(std::move(name))
 {
 }
 
@@ -16,6 +24,40 @@ unsigned int Dataset::rowCount() const { return rowsCount_; }
 
 unsigned int Dataset::columnCount() const { return columnsCount_; }
 
+QVariant Dataset::getData(int row, Column column) const
+{
+    const DataColumn& dataColumn{getDataColumn(column)};
+    switch (dataColumn.getColumnType())
+    {
+        case ColumnType::NUMBER:
+        {
+            if (dataColumn.isNull(row))
+                return QVariant(QMetaType(QMetaType::Double));
+            return QVariant(dataColumn.getNumber(row));
+        }
+
+        case ColumnType::DATE:
+        {
+            if (dataColumn.isNull(row))
+                return QVariant(QMetaType(QMetaType::QDate));
+            return QVariant(
+                QDate::fromJulianDay(dataColumn.getJulianDay(row)));
+        }
+
+        case ColumnType::STRING:
+        {
+            if (dataColumn.isNull(row))
+                return QVariant(QMetaType(QMetaType::QString));
+            return QVariant(dataColumn.getString(row));
+        }
+
+        case ColumnType::UNKNOWN:
+            break;
+    }
+    Q_ASSERT(false);
+    return {};
+}
+
 ColumnType Dataset::getColumnFormat(Column column) const
 {
     Q_ASSERT(column >= 0 && column < static_cast<int>(columnCount()));
@@ -25,83 +67,55 @@ ColumnType Dataset::getColumnFormat(Column column) const
 std::tuple<double, double> Dataset::getNumericRange(Column column) const
 {
     Q_ASSERT(ColumnType::NUMBER == getColumnFormat(column));
-    double min{0.};
-    double max{0.};
-    bool first{true};
-    for (int i = 0; i < static_cast<int>(rowCount()); ++i)
-    {
-        const double value{data_[i][column].toDouble()};
-        if (first)
-        {
-            min = value;
-            max = value;
-            first = false;
-            continue;
-        }
-
-        if (value < min)
-            min = value;
-
-        if (value > max)
-            max = value;
-    }
-    return {min, max};
+    const ColumnStatistics& statistics{getColumnStatistics(column)};
+    if (statistics.nullCount_ == 0)
+        return {statistics.minNumber_, statistics.maxNumber_};
+
+    // Empty cells are treated as 0 when filtering.
+    if (statistics.nullCount_ == static_cast<unsigned int>(rowCount()))
+        return {0., 0.};
+    return {std::min(statistics.minNumber_, 0.),
+            std::max(statistics.maxNumber_, 0.)};
 }
 
 std::tuple<QDate, QDate, bool> Dataset::getDateRange(Column column) const
 {
     Q_ASSERT(ColumnType::DATE == getColumnFormat(column));
-    QDate minDate;
-    QDate maxDate;
-    bool emptyDates{false};
-    bool first{true};
-    for (int i = 0; i < static_cast<int>(rowCount()); ++i)
-    {
-        const QVariant& dateVariant{data_[i][column]};
-        if (dateVariant.isNull())
-        {
-            emptyDates = true;
-            continue;
-        }
-        const QDate date{dateVariant.toDate()};
-        if (first)
-        {
-            minDate = date;
-            maxDate = date;
-            first = false;
-            continue;
-        }
-
-        if (date < minDate)
-            minDate = date;
-
-        if (date > maxDate)
-            maxDate = date;
-    }
+    const ColumnStatistics& statistics{getColumnStatistics(column)};
+    return {statistics.minDate_, statistics.maxDate_,
+            statistics.nullCount_ > 0};
+}
 
-    return {minDate, maxDate, emptyDates};
+const ColumnStatistics& Dataset::getColumnStatistics(Column column) const
+{
+    return getDataColumn(column).getStatistics();
 }
 
 QStringList Dataset::getStringList(Column column) const
 {
     Q_ASSERT(ColumnType::STRING == getColumnFormat(column));
-    QStringList listToFill;
-    listToFill.reserve(static_cast<int>(rowCount()));
-    for (const auto& row : data_)
-    {
-        if (row[column].isNull())
-            continue;
+    return getDataColumn(column).getDictionary();
+}
 
-        if (row[column].typeId() == QMetaType::QString)
-        {
-            listToFill.append(row[column].toString());
-            continue;
-        }
-        const int index{row[column].toInt()};
-        listToFill.append(sharedStrings_[index].toString());
-    }
-    listToFill.removeDuplicates();
-    return listToFill;
+int Dataset::getStringCode(int row, Column column) const
+{
+    const DataColumn& dataColumn{getDataColumn(column)};
+    if (dataColumn.isNull(row))
+        return -1;
+    return static_cast<int>(dataColumn.getStringCode(row));
+}
+
+QBitArray Dataset::getStringCodes(Column column,
+                                  const QStringList& strings) const
+{
+    Q_ASSERT(ColumnType::STRING == getColumnFormat(column));
+    const QStringList& dictionary{getDataColumn(column).getDictionary()};
+    const QSet<QString> stringsToFind(strings.cbegin(), strings.cend());
+    QBitArray codes(dictionary.size(), false);
+    for (qsizetype code = 0; code < dictionary.size(); ++code)
+        if (stringsToFind.contains(dictionary[code]))
+            codes.setBit(code);
+    return codes;
 }
 
 std::tuple<bool, Column> Dataset::getTaggedColumn(ColumnTag columnTag) const
@@ -125,22 +139,223 @@ QString Dataset::getName() const { return name_; }
 
 bool Dataset::initialize()
 {
-    if (!analyze())
+    if (!analyze() || isLoadingCancelled())
         return false;
     bool success{false};
     std::tie(success, sampleData_) = getSample();
-    return success;
+    return success && !isLoadingCancelled();
 }
 
 bool Dataset::loadData()
 {
     bool success{false};
-    std::tie(success, data_) = getAllData();
-    rebuildDefinitonUsingActiveColumnsOnly();
-    closeZip();
+    std::vector<DataColumn> columns;
+    const QVector<bool> loadedColumns{activeColumns_};
+    if (isColumnar())
+    {
+        std::tie(success, columns) = getAllColumns();
+        rebuildDefinitonUsingActiveColumnsOnly();
+        closeZip();
+
+        // Columns which could not be read stay empty.
+        for (auto column{static_cast<Column>(columns.size())};
+             column < static_cast<Column>(columnCount()); ++column)
+            columns.push_back(createColumn(getColumnFormat(column),
+                                           static_cast<int>(rowCount())));
+    }
+    else
+    {
+        prepareColumnsForPushing();
+        success = pushAllData();
+        rebuildDefinitonUsingActiveColumnsOnly();
+        closeZip();
+        columns = takePushedColumns();
+    }
+
+    if (isLoadingCancelled())
+    {
+        LOG(LogTypes::IMPORT_EXPORT, "Loading of " + name_ + " cancelled.");
+        return false;
+    }
+
+    finishColumns(columns, loadedColumns);
+    snapshot_ = std::make_shared<const DatasetSnapshot>(std::move(columns));
     return success;
 }
 
+void Dataset::prepareColumnsForPushing()
+{
+    pushedColumns_.clear();
+    for (Column column = 0; column < static_cast<int>(columnCount()); ++column)
+        if (activeColumns_[column])
+            pushedColumns_.push_back(createColumn(
+                getColumnFormat(column), static_cast<int>(rowCount())));
+    sharedStringsCodes_ =
+        QVector<QVector<qint64>>(static_cast<int>(pushedColumns_.size()));
+    pushedRowsCount_ = 0;
+}
+
+void Dataset::pushRows(QVector<QVector<QVariant>>& rows)
+{
+    const auto columnsCount{static_cast<int>(pushedColumns_.size())};
+    const int rowsToFill{std::min(static_cast<int>(rowCount()) -
+                                      pushedRowsCount_,
+                                  static_cast<int>(rows.size()))};
+    for (int row = 0; row < rowsToFill; ++row)
+    {
+        if (loadingCancelled_.load(std::memory_order_relaxed))
+            break;
+
+        const QVector<QVariant>& rowData{rows[row]};
+        const int targetRow{pushedRowsCount_ + row};
+        for (Column column = 0;
+             column < std::min(columnsCount, static_cast<int>(rowData.size()));
+             ++column)
+            fillCell(pushedColumns_[static_cast<std::size_t>(column)],
+                     targetRow, rowData[column], sharedStringsCodes_[column]);
+
+        // Release row as soon as it is moved into columns.
+        rows[row] = {};
+    }
+    pushedRowsCount_ += std::max(rowsToFill, 0);
+    rows.clear();
+}
+
+char* Dataset::getPushedValuesForFilling(std::size_t index)
+{
+    return pushedColumns_[index].getValuesForFilling();
+}
+
+void Dataset::finishFilledColumn(std::size_t index, quint32* stringIndexes,
+                                 QBitArray validity)
+{
+    DataColumn& dataColumn{pushedColumns_[index]};
+    if (dataColumn.getColumnType() != ColumnType::STRING)
+    {
+        dataColumn.setValidity(std::move(validity));
+        return;
+    }
+
+    // Codes follow first use of strings, as when rows are pushed.
+    const StringInterner& interner{StringInterner::getInstance()};
+    const auto sharedStringsCount{static_cast<quint32>(sharedStrings_.size())};
+    QVector<qint64> sharedStringsCodes(sharedStrings_.size(), -1);
+    QHash<quint32, quint32> otherCodes;
+    QStringList dictionary;
+    for (int row = 0; row < validity.size(); ++row)
+    {
+        if (!validity.testBit(row))
+            continue;
+
+        const quint32 sharedIndex{stringIndexes[row]};
+        const auto nextCode{static_cast<quint32>(dictionary.size())};
+        if (sharedIndex >= sharedStringsCount)
+        {
+            // Index outside of table is kept as text, as by pushRows().
+            auto it{otherCodes.constFind(sharedIndex)};
+            if (it == otherCodes.cend())
+            {
+                it = otherCodes.insert(sharedIndex, nextCode);
+                dictionary.append(
+                    QString::number(static_cast<qint32>(sharedIndex)));
+            }
+            stringIndexes[row] = it.value();
+            continue;
+        }
+
+        qint64& code{sharedStringsCodes[sharedIndex]};
+        if (code == -1)
+        {
+            code = nextCode;
+            dictionary.append(
+                interner.decode(sharedStrings_.getUtf8(sharedIndex)));
+        }
+        stringIndexes[row] = static_cast<quint32>(code);
+    }
+    dataColumn.setStrings(std::move(dictionary), stringIndexes,
+                          std::move(validity));
+}
+
+void Dataset::updateProgress(unsigned int currentRow, unsigned int rowCount,
+                             unsigned int& lastEmittedPercent)
+{
+    const unsigned int currentPercent{
+        static_cast<unsigned int>(100. * (currentRow + 1) / rowCount)};
+    if (currentPercent > lastEmittedPercent)
+    {
+        Q_EMIT loadingPercentChanged(currentPercent);
+        lastEmittedPercent = currentPercent;
+    }
+}
+
+void Dataset::cancelLoading() { loadingCancelled_ = true; }
+
+bool Dataset::isLoadingCancelled() const { return loadingCancelled_; }
+
+std::vector<DataColumn> Dataset::takePushedColumns()
+{
+    // Strings are kept in dictionaries of columns from now on.
+    sharedStrings_.clear();
+    sharedStringsCodes_.clear();
+    return std::exchange(pushedColumns_, {});
+}
+
+quint32 Dataset::getStringCode(const QVariant& value, DataColumn& dataColumn,
+                               QVector<qint64>& sharedStringsCodes)
+{
+    if (value.typeId() != QMetaType::Int)
+        return dataColumn.addToDictionary(value.toString());
+
+    const int index{value.toInt()};
+    if (index < 0 || index >= sharedStrings_.size())
+        return dataColumn.addToDictionary(value.toString());
+
+    if (sharedStringsCodes.isEmpty())
+        sharedStringsCodes.resize(sharedStrings_.size(), -1);
+
+    qint64& code{sharedStringsCodes[index]};
+    // Only strings used in column are decoded.
+    if (code == -1)
+    {
+        const StringInterner& interner{StringInterner::getInstance()};
+        code = dataColumn.addToDictionary(
+            interner.decode(sharedStrings_.getUtf8(index)));
+    }
+    return static_cast<quint32>(code);
+}
+
+void Dataset::fillCell(DataColumn& dataColumn, int row, const QVariant& value,
+                       QVector<qint64>& sharedStringsCodes)
+{
+    if (value.isNull())
+    {
+        dataColumn.setNull(row);
+        return;
+    }
+
+    switch (dataColumn.getColumnType())
+    {
+        case ColumnType::NUMBER:
+            dataColumn.setNumber(row, value.toDouble());
+            break;
+
+        case ColumnType::DATE:
+            dataColumn.setJulianDay(
+                row, static_cast<int>(value.toDate().toJulianDay()));
+            break;
+
+        case ColumnType::STRING:
+            dataColumn.setStringCode(
+                row, getStringCode(value, dataColumn, sharedStringsCodes));
+            break;
+
+        case ColumnType::UNKNOWN:
+            Q_ASSERT(false);
+            dataColumn.setNull(row);
+            break;
+    }
+}
+
 QDomElement Dataset::columnsToXml(QDomDocument& xmlDocument) const
 {
     QDomElement columns{xmlDocument.createElement(XML_COLUMNS)};
@@ -167,12 +382,22 @@ QDomElement Dataset::rowCountToXml(QDomDocument& xmlDocument,
     return rowCountElement;
 }
 
-QByteArray Dataset::definitionToXml(unsigned int rowCount) const
+QByteArray Dataset::definitionToXml(unsigned int rowCount,
+                                    DatasetFormat format,
+                                    unsigned int blockRows) const
 {
     QDomDocument xmlDocument;
     QDomElement root{xmlDocument.createElement(XML_NAME)};
+    root.setAttribute(XML_VERSION, static_cast<int>(format));
     root.appendChild(columnsToXml(xmlDocument));
     root.appendChild(rowCountToXml(xmlDocument, rowCount));
+    if (format == DatasetFormat::COLUMNAR)
+    {
+        QDomElement blockRowsElement{xmlDocument.createElement(XML_BLOCK_ROWS)};
+        blockRowsElement.setAttribute(XML_BLOCK_ROWS,
+                                      QString::number(blockRows));
+        root.appendChild(blockRowsElement);
+    }
     xmlDocument.appendChild(root);
     return xmlDocument.toByteArray();
 }
@@ -182,18 +407,163 @@ QVector<QVector<QVariant>> Dataset::retrieveSampleData()
     return std::move(sampleData_);
 }
 
+const QVector<QVector<QVariant>>& Dataset::getSampleData() const
+{
+    return sampleData_;
+}
+
 void Dataset::setActiveColumns(const QVector<bool>& activeColumns)
 {
     activeColumns_ = activeColumns;
 }
 
+QVector<bool> Dataset::getActiveColumns() const { return activeColumns_; }
+
 void Dataset::setTaggedColumn(ColumnTag columnTag, Column column)
 {
     taggedColumns_[columnTag] = column;
 }
 
+void Dataset::setLoadFilter(LoadFilter loadFilter)
+{
+    loadFilter_ = std::move(loadFilter);
+}
+
+bool Dataset::supportsLoadFilter() const { return isColumnar(); }
+
 QString Dataset::getLastError() const { return error_; }
 
+MemoryUsage Dataset::getColumnMemoryUsage(Column column) const
+{
+    const DataColumn& dataColumn{getDataColumn(column)};
+    MemoryUsage memoryUsage;
+    memoryUsage.values_ = dataColumn.getValuesMemoryUsage();
+    memoryUsage.dictionaries_ = dataColumn.getDictionaryMemoryUsage();
+    memoryUsage.spilled_ = dataColumn.getSpilledSize();
+    return memoryUsage;
+}
+
+QString Dataset::getColumnEncodingName(Column column) const
+{
+    return getDataColumn(column).getEncodingName();
+}
+
+MemoryUsage Dataset::getMemoryUsage() const
+{
+    MemoryUsage memoryUsage;
+    const Column loadedColumns{snapshot_ ? snapshot_->columnCount() : 0};
+    for (Column column = 0; column < loadedColumns; ++column)
+        memoryUsage += getColumnMemoryUsage(column);
+
+    memoryUsage.sharedStrings_ = sharedStrings_.getMemoryUsage();
+    return memoryUsage;
+}
+
+quint64 Dataset::estimateMemoryUsage() const
+{
+    // Allowance for string content held in dictionaries.
+    const quint64 averageStringBytes{16};
+    const quint64 bitsInByte{8};
+
+    // Rows are stored in typed columns, only buffered ones are variants.
+    // Values of columns backed by spill files take disk instead of memory.
+    const auto rows{static_cast<quint64>(rowCount())};
+    quint64 rowBytes{0};
+    for (Column column = 0; column < static_cast<Column>(columnCount());
+         ++column)
+    {
+        if (!activeColumns_.at(column))
+            continue;
+
+        const ColumnType columnType{getColumnFormat(column)};
+        if (!shouldSpill(columnType, rows))
+            rowBytes +=
+                static_cast<quint64>(DataColumn::getPlainValueSize(columnType));
+        if (columnType == ColumnType::STRING)
+            rowBytes += averageStringBytes;
+    }
+
+    const quint64 validityBytes{
+        (rows + bitsInByte - 1) / bitsInByte *
+        static_cast<quint64>(activeColumns_.count(true))};
+    const quint64 bufferedRows{
+        std::min(rows, static_cast<quint64>(getBufferedRowCount()))};
+    return rows * rowBytes + validityBytes +
+           estimateRowsMemoryUsage(bufferedRows) +
+           sharedStrings_.getMemoryUsage();
+}
+
+unsigned int Dataset::getBufferedRowCount() const
+{
+    const auto parsersCount{
+        static_cast<unsigned int>(std::max(1, QThread::idealThreadCount()))};
+    return 2 * parsersCount * BLOCK_ROWS_ESTIMATE;
+}
+
+quint64 Dataset::estimateRowsMemoryUsage(quint64 rows) const
+{
+    // Allowance for string content held in cells.
+    const quint64 averageStringBytes{16};
+
+    quint64 rowBytes{sizeof(QVector<QVariant>)};
+    for (Column column = 0; column < static_cast<Column>(columnCount());
+         ++column)
+    {
+        if (!activeColumns_.at(column))
+            continue;
+
+        rowBytes += sizeof(QVariant);
+        if (getColumnFormat(column) == ColumnType::STRING)
+            rowBytes += averageStringBytes;
+    }
+    return rows * rowBytes;
+}
+
+void Dataset::limitRows(unsigned int rowLimit)
+{
+    if (rowLimit >= rowsCount_)
+        return;
+    rowsCount_ = rowLimit;
+    rowsLimited_ = true;
+}
+
+void Dataset::setSpillDirectory(const QString& directory)
+{
+    spillDirectory_ = directory;
+}
+
+std::shared_ptr<const DatasetSnapshot> Dataset::getSnapshot() const
+{
+    return snapshot_;
+}
+
+const DataColumn& Dataset::getDataColumn(Column column) const
+{
+    Q_ASSERT(snapshot_ && column < snapshot_->columnCount());
+    return snapshot_->getColumn(column);
+}
+
+DataColumn Dataset::createColumn(ColumnType columnType, int rowCount) const
+{
+    if (!shouldSpill(columnType, static_cast<quint64>(rowCount)))
+        return {columnType, rowCount};
+
+    // Values are written straight into spill file while loading.
+    QDir().mkpath(spillDirectory_);
+    DataColumn dataColumn(columnType, rowCount, spillDirectory_);
+    if (!dataColumn.isSpilled())
+        LOG(LogTypes::MEMORY, "Creating spill file in " + spillDirectory_ +
+                                  " failed, column kept in memory.");
+    return dataColumn;
+}
+
+bool Dataset::shouldSpill(ColumnType columnType, quint64 rows) const
+{
+    return !spillDirectory_.isEmpty() &&
+           rows * static_cast<quint64>(DataColumn::getPlainValueSize(
+                      columnType)) >= SPILL_THRESHOLD;
+}
+
 void Dataset::rebuildDefinitonUsingActiveColumnsOnly()
 {
     QVector<ColumnType> rebuiltColumnsFormat;
@@ -226,6 +596,20 @@ void Dataset::rebuildDefinitonUsingActiveColumnsOnly()
     activeColumns_.clear();
 }
 
+bool Dataset::isColumnar() const { return false; }
+
+void Dataset::finishColumns(std::vector<DataColumn>& columns,
+                            [[maybe_unused]] const QVector<bool>& loadedColumns)
+{
+    for (auto& dataColumn : columns)
+        dataColumn.finishFilling();
+}
+
+std::tuple<bool, std::vector<DataColumn>> Dataset::getAllColumns()
+{
+    return {false, {}};
+}
+
 void Dataset::updateSampleDataStrings(QVector<QVector<QVariant>>& data) const
 {
     if (sharedStrings_.isEmpty())
@@ -242,8 +626,13 @@ void Dataset::updateSampleDataStrings(QVector<QVector<QVariant>>& data) const
                 continue;
 
             const int index{sampleDataRow[i].toInt()};
-            sampleDataRow[i] =
-                (index > sharedStrings_.size() ? 0 : sharedStrings_[index]);
+            if (index < 0 || index >= sharedStrings_.size())
+            {
+                sampleDataRow[i] = 0;
+                continue;
+            }
+
+            sampleDataRow[i] = sharedStrings_.getString(index);
         }
     }
 }
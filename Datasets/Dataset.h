@@ -1,14 +1,24 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <vector>
 
 #include <ColumnType.h>
+#include <QBitArray>
 #include <QMap>
 #include <QObject>
 #include <QVariant>
 #include <QVector>
 
 #include <ColumnTag.h>
+#include <DatasetFormat.h>
+
+#include "DataColumn.h"
+#include "DatasetSnapshot.h"
+#include "LoadFilter.h"
+#include "MemoryUsage.h"
+#include "StringsTable.h"
 
 class DatasetDefinition;
 class QDomDocument;
@@ -47,19 +57,10 @@ public:
      * @brief Get data QVariant for given row and column.
      * @param row Row for which data need to be retrieved.
      * @param column Column for which data need to be retrieved.
-     * @return Pointer to QVariant with data.
+     * @return QVariant with data, null QVariant of column type for empty
+     * cells.
      */
-    virtual inline QVariant* getData(int row, Column column)
-    {
-        if (getColumnFormat(column) == ColumnType::STRING)
-        {
-            if (data_[row][column].isNull())
-                return &nullStringVariant_;
-            if (data_[row][column].typeId() != QMetaType::QString)
-                return &sharedStrings_[data_[row][column].toInt()];
-        }
-        return &data_[row][column];
-    }
+    QVariant getData(int row, Column column) const;
 
     /**
      * @brief Get format of column with given index.
@@ -89,6 +90,29 @@ public:
      */
     QStringList getStringList(Column column) const;
 
+    /**
+     * @brief Get statistics of given column computed during loading of data.
+     * @param column Column index.
+     * @return Column statistics.
+     */
+    const ColumnStatistics& getColumnStatistics(Column column) const;
+
+    /**
+     * @brief Get dictionary code of string in given row and column.
+     * @param row Row index.
+     * @param column Column index.
+     * @return Code or -1 for empty cell.
+     */
+    int getStringCode(int row, Column column) const;
+
+    /**
+     * @brief Get dictionary codes of given strings in column.
+     * @param column Column index.
+     * @param strings Strings to find.
+     * @return Bit array with bits set for codes of found strings.
+     */
+    QBitArray getStringCodes(Column column, const QStringList& strings) const;
+
     /**
      * @brief Get index of tagged column if available.
      * @param columnTag Type of tagged column.
@@ -116,23 +140,34 @@ public:
     QString getName() const;
 
     /**
-     * @brief Initialize dataset.
-     * @return True if succeed, false otherwise.
+     * @brief Initialize dataset. Can be called from worker thread.
+     * @return True if succeed, false otherwise or when cancelLoading() was
+     * called.
      */
     bool initialize();
 
     /**
-     * @brief Load data into dataset.
-     * @return True if succeed, false otherwise.
+     * @brief Load data into dataset. Can be called from worker thread.
+     * @return True if succeed, false otherwise or when loading was cancelled.
      */
     bool loadData();
 
+    /**
+     * @brief Request stopping of initialize() or loadData() running on other
+     * thread. Data loaded so far is released.
+     */
+    void cancelLoading();
+
     /**
      * @brief Create XML with definition of dataset
      * @param rowCount Number of rows active in view.
+     * @param format Layout of .vbx file described by definition.
+     * @param blockRows Number of rows in blocks of columns for COLUMNAR.
      * @return Definition as QByteArray.
      */
-    QByteArray definitionToXml(unsigned int rowCount) const;
+    QByteArray definitionToXml(
+        unsigned int rowCount, DatasetFormat format = DatasetFormat::TEXT,
+        unsigned int blockRows = COLUMNAR_BLOCK_ROWS) const;
 
     /**
      * @brief Retrieve sample data (data is moved).
@@ -140,12 +175,24 @@ public:
      */
     QVector<QVector<QVariant>> retrieveSampleData();
 
+    /**
+     * @brief Get sample data without releasing it.
+     * @return Sample data.
+     */
+    const QVector<QVector<QVariant>>& getSampleData() const;
+
     /**
      * @brief Set active columns in dataset.
      * @param activeColumns Active columns flags vector.
      */
     void setActiveColumns(const QVector<bool>& activeColumns);
 
+    /**
+     * @brief Get active columns chosen before loading.
+     * @return Active columns flags vector, empty when not chosen yet.
+     */
+    QVector<bool> getActiveColumns() const;
+
     /**
      * @brief Set tagged column in dataset.
      * @param columnTag Column tag.
@@ -153,24 +200,186 @@ public:
      */
     void setTaggedColumn(ColumnTag columnTag, Column column);
 
+    /**
+     * @brief Set condition which rows need to meet to be loaded. Row count
+     * is updated by loadData().
+     * @param loadFilter Filter on one of columns.
+     */
+    void setLoadFilter(LoadFilter loadFilter);
+
+    /**
+     * @brief Check if source can skip rows using filter set by
+     * setLoadFilter(). Other sources load all rows.
+     * @return True if load filter is applied, false otherwise.
+     */
+    bool supportsLoadFilter() const;
+
     /**
      * @brief Get last error.
      * @return Last error.
      */
     QString getLastError() const;
 
+    /**
+     * @brief Get memory used by given column.
+     * @param column Column index.
+     * @return Memory usage of values and dictionary of column.
+     */
+    MemoryUsage getColumnMemoryUsage(Column column) const;
+
+    /**
+     * @brief Get name of encoding used for values of given column.
+     * @param column Column index.
+     * @return Encoding name.
+     */
+    QString getColumnEncodingName(Column column) const;
+
+    /**
+     * @brief Get memory used by all columns and strings table of source.
+     * @return Memory usage of dataset.
+     */
+    MemoryUsage getMemoryUsage() const;
+
+    /**
+     * @brief Estimate peak memory needed by loadData using row count, types
+     * and active columns known after initialization. Values of columns which
+     * will be kept in spill files are not counted.
+     * @return Number of bytes.
+     */
+    quint64 estimateMemoryUsage() const;
+
+    /**
+     * @brief Load only first rows of data.
+     * @param rowLimit Maximum number of rows to load.
+     */
+    void limitRows(unsigned int rowLimit);
+
+    /**
+     * @brief Enable paging of large columns to memory-mapped files. Values
+     * of such columns are written to files already while loading.
+     * @param directory Directory for spill files, empty to keep data in RAM.
+     */
+    void setSpillDirectory(const QString& directory);
+
+    /**
+     * @brief Get immutable snapshot of loaded columns. Snapshot can be read
+     * from many threads and outlives dataset when copy of pointer is kept.
+     * @return Snapshot or nullptr when data is not loaded.
+     */
+    std::shared_ptr<const DatasetSnapshot> getSnapshot() const;
+
 protected:
     virtual bool analyze() = 0;
 
     virtual std::tuple<bool, QVector<QVector<QVariant>>> getSample() = 0;
 
-    virtual std::tuple<bool, QVector<QVector<QVariant>>> getAllData() = 0;
+    /**
+     * @brief Load data of active columns passing consecutive batches of rows
+     * to pushRows(), so whole table of variants is never kept in memory.
+     * @return True if succeed, false otherwise.
+     */
+    virtual bool pushAllData() = 0;
 
     virtual void closeZip() = 0;
 
+    /**
+     * @brief Check if source keeps data in columns which can be loaded
+     * directly using getAllColumns() instead of rows of pushAllData().
+     * @return True if columnar, false otherwise.
+     */
+    virtual bool isColumnar() const;
+
+    /**
+     * @brief Load active columns, not finished yet.
+     * @return Flag indicating success and columns.
+     */
+    virtual std::tuple<bool, std::vector<DataColumn>> getAllColumns();
+
+    /**
+     * @brief Complete statistics of loaded columns.
+     * @param columns Loaded columns.
+     * @param loadedColumns Flags of columns of source which were loaded.
+     */
+    virtual void finishColumns(std::vector<DataColumn>& columns,
+                               const QVector<bool>& loadedColumns);
+
+    /**
+     * @brief Get number of rows kept as variants at once while loading, in
+     * blocks parsed but not stored yet.
+     * @return Number of rows.
+     */
+    virtual unsigned int getBufferedRowCount() const;
+
+    /**
+     * @brief Estimate memory of rows of variants holding active columns.
+     * @param rows Number of rows.
+     * @return Number of bytes.
+     */
+    quint64 estimateRowsMemoryUsage(quint64 rows) const;
+
+    /**
+     * @brief Create empty column for loading, backed by spill file when
+     * spilling is enabled and column is big enough.
+     * @param columnType Type of column.
+     * @param rowCount Number of rows.
+     * @return Column.
+     */
+    DataColumn createColumn(ColumnType columnType, int rowCount) const;
+
     void updateSampleDataStrings(QVector<QVector<QVariant>>& data) const;
 
-    QVector<QVariant> sharedStrings_;
+    /**
+     * @brief Check if sources should stop loading data.
+     * @return True if cancelLoading() was called, false otherwise.
+     */
+    bool isLoadingCancelled() const;
+
+    /**
+     * @brief Move rows into columns of dataset. Rows are released as soon as
+     * they are stored. Rows above row count are ignored.
+     * @param rows Batch of rows following previously pushed ones, containing
+     * values of active columns only.
+     */
+    void pushRows(QVector<QVector<QVariant>>& rows);
+
+    /**
+     * @brief Prepare empty columns for pushRows(). Calling it again discards
+     * rows pushed so far, so loading can be restarted.
+     */
+    void prepareColumnsForPushing();
+
+    /**
+     * @brief Get memory of plain values of pushed column. Sources knowing
+     * first row of each parsed block use it instead of pushRows() to fill
+     * rows from many threads at once. For STRING column indexes of strings
+     * table of source are written.
+     * @param index Index of pushed column, counting active columns only.
+     * @return Values of all rows, nullptr when not available for STRING
+     * column, then caller needs own buffer of indexes.
+     */
+    char* getPushedValuesForFilling(std::size_t index);
+
+    /**
+     * @brief Complete pushed column filled using getPushedValuesForFilling().
+     * @param index Index of pushed column, counting active columns only.
+     * @param stringIndexes For STRING column indexes of strings table of
+     * source for each row, replaced by codes of column.
+     * @param validity Bitmap with bits set for not null rows.
+     */
+    void finishFilledColumn(std::size_t index, quint32* stringIndexes,
+                            QBitArray validity);
+
+    /**
+     * @brief Emit loadingPercentChanged() when percent of loaded items grows.
+     * @param currentRow Index of last loaded item.
+     * @param rowCount Number of all items.
+     * @param lastEmittedPercent Percent emitted last time, updated.
+     */
+    void updateProgress(unsigned int currentRow, unsigned int rowCount,
+                        unsigned int& lastEmittedPercent);
+
+    /// Strings table of source, needed only until data is loaded.
+    StringsTable sharedStrings_;
 
     bool valid_{false};
 
@@ -184,10 +393,16 @@ protected:
 
     unsigned int rowsCount_{0};
 
+    /// Flag indicating that rowsCount_ was lowered using limitRows().
+    bool rowsLimited_{false};
+
     unsigned int columnsCount_{0};
 
     QString error_;
 
+    /// Condition for loaded rows, applied by columnar sources only.
+    LoadFilter loadFilter_;
+
     const QString XML_NAME{QStringLiteral("DATASET")};
     const QString XML_COLUMNS{QStringLiteral("COLUMNS")};
     const QString XML_COLUMN{QStringLiteral("COLUMN")};
@@ -196,6 +411,8 @@ protected:
     const QString XML_COLUMN_TAG{QStringLiteral("TAG")};
     const QString XML_COLUMN_TAG_DEPRECATED{QStringLiteral("SPECIAL_TAG")};
     const QString XML_ROW_COUNT{QStringLiteral("ROW_COUNT")};
+    const QString XML_VERSION{QStringLiteral("VERSION")};
+    const QString XML_BLOCK_ROWS{QStringLiteral("BLOCK_ROWS")};
 
 private:
     void rebuildDefinitonUsingActiveColumnsOnly();
@@ -207,14 +424,43 @@ private:
     QDomElement rowCountToXml(QDomDocument& xmlDocument,
                               unsigned int rowCount) const;
 
-    QVariant nullStringVariant_;
+    std::vector<DataColumn> takePushedColumns();
+
+    const DataColumn& getDataColumn(Column column) const;
+
+    bool shouldSpill(ColumnType columnType, quint64 rows) const;
+
+    quint32 getStringCode(const QVariant& value, DataColumn& dataColumn,
+                          QVector<qint64>& sharedStringsCodes);
+
+    void fillCell(DataColumn& dataColumn, int row, const QVariant& value,
+                  QVector<qint64>& sharedStringsCodes);
 
     const QString name_;
 
     QVector<QVector<QVariant>> sampleData_;
 
-    /// Data of dataset. String columns got names in sharedStrings_.
-    QVector<QVector<QVariant>> data_;
+    /// Columns filled by pushRows() while data is loaded.
+    std::vector<DataColumn> pushedColumns_;
+
+    /// Per column mapping of shared strings indexes into dictionary codes.
+    QVector<QVector<qint64>> sharedStringsCodes_;
+
+    int pushedRowsCount_{0};
+
+    std::atomic<bool> loadingCancelled_{false};
+
+    /// Data of dataset, one typed storage per column, set by loadData().
+    std::shared_ptr<const DatasetSnapshot> snapshot_;
+
+    /// Directory for spill files, empty when data is kept in RAM.
+    QString spillDirectory_;
+
+    /// Columns with smaller plain values arrays are not spilled.
+    static constexpr quint64 SPILL_THRESHOLD{1024 * 1024};
+
+    /// Rows expected in parsed block, two blocks per parser are buffered.
+    static constexpr unsigned int BLOCK_ROWS_ESTIMATE{16'384};
 
     /// Stores information about columns which are tagged.
     QMap<ColumnTag, Column> taggedColumns_;
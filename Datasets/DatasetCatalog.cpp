@@ -0,0 +1,177 @@
+#include "DatasetCatalog.h"
+
+#include <QDomDocument>
+#include <QFileInfo>
+#include <QSaveFile>
+
+#include <DatasetUtilities.h>
+#include <FileUtilities.h>
+#include <Logger.h>
+
+#include "DatasetInner.h"
+
+namespace
+{
+QString getCatalogPath()
+{
+    return DatasetUtilities::getDatasetsDir() +
+           DatasetUtilities::getDatasetsCatalogFilename();
+}
+
+QFileInfo getDatasetFileInfo(const QString& name)
+{
+    return QFileInfo(DatasetUtilities::getDatasetsDir() + name +
+                     DatasetUtilities::getDatasetExtension());
+}
+}  // namespace
+
+bool DatasetCatalog::refresh()
+{
+    const QMap<QString, Entry> savedEntries{load()};
+    entries_.clear();
+    bool changed{false};
+    const QStringList names{DatasetUtilities::getListOfAvailableDatasets()};
+    for (const QString& name : names)
+    {
+        const QFileInfo fileInfo{getDatasetFileInfo(name)};
+        const auto it{savedEntries.constFind(name)};
+        if (it != savedEntries.cend() && it->size_ == fileInfo.size() &&
+            it->lastModified_.toMSecsSinceEpoch() ==
+                fileInfo.lastModified().toMSecsSinceEpoch())
+        {
+            entries_.append(*it);
+            continue;
+        }
+
+        entries_.append(readEntry(name));
+        changed = true;
+    }
+
+    // Removed datasets are dropped from catalog.
+    if (!changed && savedEntries.size() == entries_.size())
+        return true;
+
+    if (!save())
+    {
+        LOG(LogTypes::IMPORT_EXPORT,
+            "Can not save datasets catalog " + getCatalogPath() + ".");
+        return false;
+    }
+    return true;
+}
+
+const QVector<DatasetCatalog::Entry>& DatasetCatalog::getEntries() const
+{
+    return entries_;
+}
+
+QMap<QString, DatasetCatalog::Entry> DatasetCatalog::load() const
+{
+    const auto [success, content] = FileUtilities::loadFile(getCatalogPath());
+    QDomDocument xmlDocument;
+    if (!success || !xmlDocument.setContent(content))
+        return {};
+
+    QMap<QString, Entry> entries;
+    const QDomNodeList datasets{
+        xmlDocument.documentElement().elementsByTagName(XML_DATASET)};
+    for (int i = 0; i < datasets.size(); ++i)
+    {
+        Entry entry{entryFromXml(datasets.at(i).toElement())};
+        entries.insert(entry.name_, std::move(entry));
+    }
+    return entries;
+}
+
+bool DatasetCatalog::save() const
+{
+    QDomDocument xmlDocument;
+    QDomElement root{xmlDocument.createElement(XML_NAME)};
+    for (const Entry& entry : entries_)
+        root.appendChild(entryToXml(xmlDocument, entry));
+    xmlDocument.appendChild(root);
+
+    QSaveFile file(getCatalogPath());
+    return file.open(QIODevice::WriteOnly) &&
+           file.write(xmlDocument.toByteArray()) != -1 && file.commit();
+}
+
+DatasetCatalog::Entry DatasetCatalog::readEntry(const QString& name)
+{
+    const QFileInfo fileInfo{getDatasetFileInfo(name)};
+    Entry entry;
+    entry.name_ = name;
+    entry.size_ = fileInfo.size();
+    entry.lastModified_ = fileInfo.lastModified();
+
+    // Damaged datasets are listed without metadata.
+    DatasetInner dataset(name);
+    if (!dataset.readDefinition())
+        return entry;
+
+    entry.rowCount_ = dataset.rowCount();
+    for (Column column = 0; column < static_cast<Column>(dataset.columnCount());
+         ++column)
+        entry.columnTypes_.append(dataset.getColumnFormat(column));
+    for (const ColumnTag tag : {ColumnTag::DATE, ColumnTag::VALUE})
+    {
+        const auto [tagged, column] = dataset.getTaggedColumn(tag);
+        if (tagged)
+            entry.taggedColumns_.insert(tag, column);
+    }
+    return entry;
+}
+
+DatasetCatalog::Entry DatasetCatalog::entryFromXml(
+    const QDomElement& element) const
+{
+    Entry entry;
+    entry.name_ = element.attribute(XML_DATASET_NAME);
+    entry.rowCount_ = element.attribute(XML_ROW_COUNT).toUInt();
+    entry.size_ = element.attribute(XML_SIZE).toLongLong();
+    entry.lastModified_ = QDateTime::fromMSecsSinceEpoch(
+        element.attribute(XML_LAST_MODIFIED).toLongLong());
+
+    const QStringList columnTypes{
+        element.attribute(XML_COLUMN_TYPES).split(',', Qt::SkipEmptyParts)};
+    for (const QString& columnType : columnTypes)
+        entry.columnTypes_.append(static_cast<ColumnType>(columnType.toInt()));
+
+    // Tags are stored as tag:column pairs.
+    const QStringList taggedColumns{
+        element.attribute(XML_TAGGED_COLUMNS).split(',', Qt::SkipEmptyParts)};
+    for (const QString& taggedColumn : taggedColumns)
+    {
+        const QStringList tagAndColumn{taggedColumn.split(':')};
+        if (tagAndColumn.size() == 2)
+            entry.taggedColumns_.insert(
+                static_cast<ColumnTag>(tagAndColumn.front().toInt()),
+                tagAndColumn.back().toInt());
+    }
+    return entry;
+}
+
+QDomElement DatasetCatalog::entryToXml(QDomDocument& xmlDocument,
+                                       const Entry& entry) const
+{
+    QDomElement element{xmlDocument.createElement(XML_DATASET)};
+    element.setAttribute(XML_DATASET_NAME, entry.name_);
+    element.setAttribute(XML_ROW_COUNT, QString::number(entry.rowCount_));
+    element.setAttribute(XML_SIZE, QString::number(entry.size_));
+    element.setAttribute(
+        XML_LAST_MODIFIED,
+        QString::number(entry.lastModified_.toMSecsSinceEpoch()));
+
+    QStringList columnTypes;
+    for (const ColumnType columnType : entry.columnTypes_)
+        columnTypes.append(QString::number(static_cast<int>(columnType)));
+    element.setAttribute(XML_COLUMN_TYPES, columnTypes.join(','));
+
+    QStringList taggedColumns;
+    for (auto it{entry.taggedColumns_.cbegin()};
+         it != entry.taggedColumns_.cend(); ++it)
+        taggedColumns.append(QString::number(static_cast<int>(it.key())) +
+                             ":" + QString::number(it.value()));
+    element.setAttribute(XML_TAGGED_COLUMNS, taggedColumns.join(','));
+    return element;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <QDateTime>
+#include <QMap>
+#include <QString>
+#include <QVector>
+
+#include <ColumnTag.h>
+#include <ColumnType.h>
+
+class QDomDocument;
+class QDomElement;
+
+/**
+ * @class DatasetCatalog
+ * @brief Metadata of datasets from datasets dir kept in catalog file, so
+ * datasets can be listed without opening them. Only datasets added or
+ * changed since last refresh are opened and only their definitions are read.
+ */
+class DatasetCatalog
+{
+public:
+    /// Metadata of single dataset.
+    struct Entry
+    {
+        QString name_;
+
+        unsigned int rowCount_{0};
+
+        QVector<ColumnType> columnTypes_;
+
+        qint64 size_{0};
+
+        QDateTime lastModified_;
+
+        QMap<ColumnTag, int> taggedColumns_;
+    };
+
+    /**
+     * @brief Load catalog file and update it using content of datasets dir.
+     * @return True if catalog file is up to date, false if it could not be
+     * saved.
+     */
+    bool refresh();
+
+    /**
+     * @brief Get entries of datasets available in datasets dir.
+     * @return Entries sorted by name.
+     */
+    const QVector<Entry>& getEntries() const;
+
+private:
+    QMap<QString, Entry> load() const;
+
+    bool save() const;
+
+    static Entry readEntry(const QString& name);
+
+    Entry entryFromXml(const QDomElement& element) const;
+
+    QDomElement entryToXml(QDomDocument& xmlDocument,
+                           const Entry& entry) const;
+
+    QVector<Entry> entries_;
+
+    const QString XML_NAME{QStringLiteral("CATALOG")};
+    const QString XML_DATASET{QStringLiteral("DATASET")};
+    const QString XML_DATASET_NAME{QStringLiteral("NAME")};
+    const QString XML_ROW_COUNT{QStringLiteral("ROW_COUNT")};
+    const QString XML_COLUMN_TYPES{QStringLiteral("COLUMN_TYPES")};
+    const QString XML_SIZE{QStringLiteral("SIZE")};
+    const QString XML_LAST_MODIFIED{QStringLiteral("LAST_MODIFIED")};
+    const QString XML_TAGGED_COLUMNS{QStringLiteral("TAGGED_COLUMNS")};
+};
@@ -1,35 +1,137 @@
 #include "DatasetInner.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <vector>
+
 #include <quazip/quazipfile.h>
-#include <QCoreApplication>
 #include <QDir>
 #include <QDomDocument>
-#include <QTextStream>
+#include <QThread>
+#include <QtEndian>
 
 #include <DatasetUtilities.h>
 #include <Logger.h>
 
+#include "StringInterner.h"
+
+namespace
+{
+template <typename T>
+bool readLittleEndian(const char*& current, const char* end, T& value)
+{
+    if (end - current < static_cast<qsizetype>(sizeof(T)))
+        return false;
+    value = qFromLittleEndian<T>(current);
+    current += sizeof(T);
+    return true;
+}
+
+QVariant getSampleVariant(const DataColumn& dataColumn, int row)
+{
+    switch (dataColumn.getColumnType())
+    {
+        case ColumnType::NUMBER:
+            if (dataColumn.isNull(row))
+                return QVariant(QMetaType(QMetaType::Double));
+            return QVariant(dataColumn.getNumber(row));
+
+        case ColumnType::DATE:
+            if (dataColumn.isNull(row))
+                return QVariant(QMetaType(QMetaType::QDate));
+            return QVariant(QDate::fromJulianDay(dataColumn.getJulianDay(row)));
+
+        case ColumnType::STRING:
+            if (dataColumn.isNull(row))
+                return QVariant(QMetaType(QMetaType::QString));
+            return QVariant(dataColumn.getString(row));
+
+        case ColumnType::UNKNOWN:
+            break;
+    }
+    return QVariant(QMetaType(QMetaType::QString));
+}
+
+void compactDictionary(QStringList& dictionary, quint32* codes,
+                       const QBitArray& validity)
+{
+    // Only strings used by loaded rows are kept, in order of dictionary.
+    QVector<quint32> newCodes(dictionary.size(),
+                              std::numeric_limits<quint32>::max());
+    for (int row = 0; row < validity.size(); ++row)
+        if (validity.testBit(row))
+            newCodes[codes[row]] = 0;
+
+    QStringList usedStrings;
+    for (qsizetype code = 0; code < dictionary.size(); ++code)
+    {
+        if (newCodes[code] == std::numeric_limits<quint32>::max())
+            continue;
+        newCodes[code] = static_cast<quint32>(usedStrings.size());
+        usedStrings.append(dictionary[code]);
+    }
+
+    for (int row = 0; row < validity.size(); ++row)
+        if (validity.testBit(row))
+            codes[row] = newCodes[codes[row]];
+    dictionary = std::move(usedStrings);
+}
+}  // namespace
+
 DatasetInner::DatasetInner(const QString& name, QObject* parent)
-    : Dataset(name, parent), datasetsDir_(DatasetUtilities::getDatasetsDir())
+    : DatasetInner(name,
+                   DatasetUtilities::getDatasetsDir() + name +
+                       DatasetUtilities::getDatasetExtension(),
+                   parent)
 {
-    zip_.setZipName(datasetsDir_ + name +
-                    DatasetUtilities::getDatasetExtension());
+}
+
+DatasetInner::DatasetInner(const QString& name, const QString& filePath,
+                           QObject* parent)
+    : Dataset(name, parent),
+      statisticsCache_(
+          filePath.chopped(DatasetUtilities::getDatasetExtension().size()) +
+          DatasetUtilities::getDatasetStatisticsExtension())
+{
+    zip_.setZipName(filePath);
 }
 
 bool DatasetInner::analyze()
 {
     if (!openZip())
         return false;
+    statisticsKey_ = StatisticsCache::computeKey(zip_);
 
-    QByteArray definitionContent;
-    if (!loadXmlFile(definitionContent, zip_) || !fromXml(definitionContent) ||
-        !loadStrings(zip_))
+    if (!loadDefinition())
+        return false;
+
+    // Columnar format keeps dictionary of each column in own block.
+    if (!isColumnar() && !loadStrings(zip_))
         return false;
 
     valid_ = true;
     return true;
 }
 
+bool DatasetInner::readDefinition()
+{
+    if (!openZip())
+        return false;
+    const bool success{loadDefinition()};
+    closeZip();
+    return success;
+}
+
+bool DatasetInner::loadDefinition()
+{
+    QByteArray definitionContent;
+    return loadXmlFile(definitionContent, zip_) && fromXml(definitionContent);
+}
+
 void DatasetInner::closeZip() { zip_.close(); }
 
 bool DatasetInner::openZip()
@@ -42,25 +144,44 @@ bool DatasetInner::openZip()
     return true;
 }
 
+bool DatasetInner::isColumnar() const
+{
+    return format_ == DatasetFormat::COLUMNAR;
+}
+
 std::tuple<bool, QVector<QVector<QVariant>>> DatasetInner::getSample()
 {
-    auto [success, data] = fillData(zip_, true);
-    if (!success)
+    if (isColumnar())
+        return getColumnarSample();
+
+    QuaZipFile zipFile(&zip_);
+    if (!openDataFile(zipFile))
         return {false, {}};
 
+    QVector<QVector<QVariant>> data{parseSampleData(zipFile)};
     updateSampleDataStrings(data);
     return {true, data};
 }
 
-std::tuple<bool, QVector<QVector<QVariant>>> DatasetInner::getAllData()
+bool DatasetInner::pushAllData()
 {
     if (!isValid())
-        return {false, {}};
+        return false;
 
-    QVector<QVector<QVariant>> data;
-    std::tie(valid_, data) = fillData(zip_, false);
+    QuaZipFile zipFile(&zip_);
+    if (!openDataFile(zipFile))
+    {
+        valid_ = false;
+        return false;
+    }
 
-    return {true, data};
+    parseAllData(zipFile);
+    if (isLoadingCancelled())
+        return false;
+
+    LOG(LogTypes::IMPORT_EXPORT,
+        "Loaded " + QString::number(rowCount()) + " rows.");
+    return true;
 }
 
 void DatasetInner::retrieveColumnsFromXml(const QDomElement& root)
@@ -110,6 +231,33 @@ bool DatasetInner::fromXml(QByteArray& definitionContent)
     retrieveColumnsFromXml(root);
     rowsCount_ =
         root.firstChildElement(XML_ROW_COUNT).attribute(XML_ROW_COUNT).toUInt();
+    fileRowCount_ = rowsCount_;
+
+    // Files without version were created before columnar format was added.
+    const QString textVersion{
+        QString::number(static_cast<int>(DatasetFormat::TEXT))};
+    const int version{root.attribute(XML_VERSION, textVersion).toInt()};
+    if (version != static_cast<int>(DatasetFormat::TEXT) &&
+        version != static_cast<int>(DatasetFormat::COLUMNAR))
+    {
+        LOG(LogTypes::IMPORT_EXPORT,
+            "Unsupported version " + QString::number(version) + ".");
+        return false;
+    }
+    format_ = static_cast<DatasetFormat>(version);
+
+    if (isColumnar())
+    {
+        blockRows_ = root.firstChildElement(XML_BLOCK_ROWS)
+                         .attribute(XML_BLOCK_ROWS)
+                         .toUInt();
+        if (blockRows_ == 0)
+        {
+            LOG(LogTypes::IMPORT_EXPORT,
+                QStringLiteral("Missing size of blocks."));
+            return false;
+        }
+    }
 
     return true;
 }
@@ -148,152 +296,778 @@ bool DatasetInner::loadStrings(QuaZip& zip)
     if (!openQuaZipFile(zipFile))
         return false;
 
-    const QList<QByteArray> strings{zipFile.readAll().split('\n')};
+    // First element need to be empty. Strings are decoded when used.
+    sharedStrings_.append({});
+    sharedStrings_.appendLines(zipFile.readAll());
+    return true;
+}
+
+QVector<QVector<QVariant>> DatasetInner::parseSampleData(
+    QIODevice& device) const
+{
+    // Sample contains all columns, also inactive ones.
+    const InnerLineTokenizer tokenizer(columnTypes_, {});
+    unsigned int lineCounter{0};
+    QVector<QVector<QVariant>> data{prepareContainerForSampleData()};
+    while (!device.atEnd() && lineCounter < rowCount() &&
+           lineCounter < SAMPLE_SIZE)
+    {
+        QByteArray line{device.readLine()};
+        while (line.endsWith('\n') || line.endsWith('\r'))
+            line.chop(1);
+        data[static_cast<int>(lineCounter)] =
+            tokenizer.tokenize(line.cbegin(), line.cend());
+        lineCounter++;
+    }
+    return data;
+}
+
+unsigned int DatasetInner::readBlocks(QIODevice& device,
+                                      DataBlockQueue& queue,
+                                      const std::atomic<bool>& outOfMemory)
+{
+    // Part of line not finished in previous block.
+    QByteArray tail;
+    unsigned int firstRow{0};
+    unsigned int lastEmittedPercent{0};
+    bool lastBlock{false};
+    while (!lastBlock && firstRow < rowCount() && !isLoadingCancelled() &&
+           !outOfMemory)
+    {
+        const QByteArray inflated{device.read(BLOCK_SIZE)};
+        lastBlock = (inflated.isEmpty() || device.atEnd());
 
-    // First element need to be empty.
-    sharedStrings_.append(QVariant(QString()));
-    for (const auto& currentString : strings)
-        sharedStrings_.append(QVariant(QString::fromUtf8(currentString)));
+        // Blocks end after new line character, so lines are not split.
+        DataBlock block{tail + inflated, firstRow};
+        tail.clear();
+        if (!lastBlock)
+        {
+            const qsizetype lastNewLine{block.bytes_.lastIndexOf('\n')};
+            tail = block.bytes_.sliced(lastNewLine + 1);
+            block.bytes_.truncate(lastNewLine + 1);
+        }
+        if (block.bytes_.isEmpty())
+            continue;
 
-    return true;
+        // Counting lines is much faster than parsing, it is done here to
+        // know rows of blocks filled by many threads.
+        const auto lines{static_cast<unsigned int>(
+            std::count(block.bytes_.cbegin(), block.bytes_.cend(), '\n'))};
+        firstRow += lines + (block.bytes_.endsWith('\n') ? 0 : 1);
+
+        while (!queue.tryPush(block, PROGRESS_INTERVAL_MS))
+            if (isLoadingCancelled() || outOfMemory)
+                return std::min(firstRow, rowCount());
+
+        // Progress counts rows passed to parsers, which lag by queue size.
+        const unsigned int readRows{std::min(firstRow, rowCount())};
+        if (readRows > 0)
+            updateProgress(readRows - 1, rowCount(), lastEmittedPercent);
+    }
+    return std::min(firstRow, rowCount());
+}
+
+void DatasetInner::fillBlock(const DataBlock& block,
+                             const InnerLineTokenizer& tokenizer,
+                             const QVector<char*>& values,
+                             QVector<QVector<int>>& nulls) const
+{
+    QVector<ColumnType> pushedTypes;
+    for (Column column = 0; column < static_cast<Column>(columnCount());
+         ++column)
+        if (activeColumns_[column])
+            pushedTypes.append(getColumnFormat(column));
+
+    const char* current{block.bytes_.cbegin()};
+    const char* blockEnd{block.bytes_.cend()};
+    auto row{static_cast<int>(block.firstRow_)};
+    while (current < blockEnd && row < static_cast<int>(rowCount()))
+    {
+        const auto* newLine{static_cast<const char*>(
+            std::memchr(current, '\n', blockEnd - current))};
+        const char* lineEnd{newLine != nullptr ? newLine : blockEnd};
+        const char* next{newLine != nullptr ? newLine + 1 : blockEnd};
+        if (lineEnd > current && *(lineEnd - 1) == '\r')
+            --lineEnd;
+
+        const QVector<QVariant> rowData{tokenizer.tokenize(current, lineEnd)};
+        for (int column = 0; column < rowData.size(); ++column)
+        {
+            const QVariant& value{rowData[column]};
+            if (value.isNull())
+            {
+                nulls[column].append(row);
+                continue;
+            }
+            switch (pushedTypes[column])
+            {
+                case ColumnType::NUMBER:
+                    reinterpret_cast<double*>(values[column])[row] =
+                        value.toDouble();
+                    break;
+
+                case ColumnType::DATE:
+                    reinterpret_cast<qint32*>(values[column])[row] =
+                        static_cast<qint32>(value.toDate().toJulianDay());
+                    break;
+
+                case ColumnType::STRING:
+                    reinterpret_cast<quint32*>(values[column])[row] =
+                        static_cast<quint32>(value.toInt());
+                    break;
+
+                case ColumnType::UNKNOWN:
+                    Q_ASSERT(false);
+                    nulls[column].append(row);
+                    break;
+            }
+        }
+        current = next;
+        ++row;
+    }
+}
+
+void DatasetInner::parseAllData(QIODevice& device)
+{
+    // Parsers write values of rows straight into columns, as first row of
+    // each block is known. Only nulls are collected and applied here.
+    const auto columnsCount{static_cast<int>(activeColumns_.count(true))};
+    QVector<char*> values(columnsCount);
+    QVector<QVector<quint32>> stringIndexes(columnsCount);
+    for (int column = 0; column < columnsCount; ++column)
+    {
+        values[column] =
+            getPushedValuesForFilling(static_cast<std::size_t>(column));
+        if (values[column] != nullptr)
+            continue;
+        stringIndexes[column].resize(rowCount());
+        values[column] = reinterpret_cast<char*>(stringIndexes[column].data());
+    }
+
+    const InnerLineTokenizer tokenizer(columnTypes_, activeColumns_);
+    const int parsersCount{std::max(1, QThread::idealThreadCount() - 1)};
+    DataBlockQueue queue(2 * parsersCount);
+    std::atomic<bool> outOfMemory{false};
+    std::vector<QVector<QVector<int>>> nulls(
+        static_cast<std::size_t>(parsersCount),
+        QVector<QVector<int>>(columnsCount));
+    std::vector<std::unique_ptr<QThread>> parsers;
+    for (auto& parserNulls : nulls)
+    {
+        parsers.emplace_back(QThread::create(
+            [this, &queue, &tokenizer, &values, &parserNulls, &outOfMemory]()
+            {
+                // Exception leaving thread would terminate application.
+                try
+                {
+                    DataBlock block;
+                    while (queue.pop(block))
+                        fillBlock(block, tokenizer, values, parserNulls);
+                }
+                catch (const std::bad_alloc&)
+                {
+                    outOfMemory = true;
+                    queue.close();
+                }
+            }));
+        parsers.back()->start();
+    }
+
+    // Inflating on this thread overlaps with parsing.
+    unsigned int readRows{0};
+    try
+    {
+        readRows = readBlocks(device, queue, outOfMemory);
+    }
+    catch (const std::bad_alloc&)
+    {
+        outOfMemory = true;
+    }
+    queue.close();
+    for (const auto& parser : parsers)
+        parser->wait();
+
+    // Reported on loading thread, where caller handles lack of memory.
+    if (outOfMemory)
+        throw std::bad_alloc();
+    if (isLoadingCancelled())
+        return;
+
+    for (int column = 0; column < columnsCount; ++column)
+    {
+        QBitArray validity(static_cast<qsizetype>(readRows), true);
+        validity.resize(rowCount());
+        for (const auto& parserNulls : nulls)
+            for (const int row : parserNulls[column])
+                validity.clearBit(row);
+        finishFilledColumn(static_cast<std::size_t>(column),
+                           reinterpret_cast<quint32*>(values[column]),
+                           std::move(validity));
+        stringIndexes[column] = {};
+    }
+}
+
+bool DatasetInner::openDataFile(QuaZipFile& zipFile)
+{
+    zip_.setCurrentFile(DatasetUtilities::getDatasetDataFilename());
+    return openQuaZipFile(zipFile);
+}
+
+QVector<QVector<QVariant>> DatasetInner::prepareContainerForSampleData() const
+{
+    QVector<QVector<QVariant>> data;
+    const int rowsCountForSamples =
+        static_cast<int>((rowCount() > SAMPLE_SIZE ? SAMPLE_SIZE : rowCount()));
+    data.resize(rowsCountForSamples);
+    for (int i = 0; i < rowsCountForSamples; ++i)
+        data[i].resize(static_cast<int>(columnsCount_));
+    return data;
+}
+
+std::tuple<bool, std::vector<DataColumn>> DatasetInner::getAllColumns()
+{
+    if (!isValid())
+        return {false, {}};
+
+    auto [selected, selection] = selectRows();
+    if (!selected)
+    {
+        valid_ = false;
+        return {false, {}};
+    }
+
+    std::vector<DataColumn> columns;
+    const auto activeColumnsCount{
+        static_cast<unsigned int>(activeColumns_.count(true))};
+    columns.reserve(activeColumnsCount);
+    unsigned int lastEmittedPercent{0};
+    for (Column column = 0; column < static_cast<int>(columnCount()); ++column)
+    {
+        if (isLoadingCancelled())
+            return {false, std::move(columns)};
+
+        if (!activeColumns_[column])
+            continue;
+
+        // Inactive columns and skipped blocks are not decompressed at all.
+        columns.push_back(
+            createColumn(getColumnFormat(column), selection.rowCount_));
+        if (!readColumn(column, selection, columns.back()))
+        {
+            valid_ = false;
+            return {false, std::move(columns)};
+        }
+        updateProgress(static_cast<unsigned int>(columns.size()) - 1,
+                       activeColumnsCount, lastEmittedPercent);
+    }
+
+    // Blocks are located using row count of file, so it changes at the end.
+    rowsCount_ = static_cast<unsigned int>(selection.rowCount_);
+    LOG(LogTypes::IMPORT_EXPORT,
+        "Loaded " + QString::number(rowCount()) + " rows.");
+
+    return {true, std::move(columns)};
+}
+
+void DatasetInner::finishColumns(std::vector<DataColumn>& columns,
+                                 const QVector<bool>& loadedColumns)
+{
+    // Statistics of filtered or limited rows differ from ones of whole file.
+    if (!loadFilter_.isEmpty() || rowCount() != fileRowCount_)
+    {
+        Dataset::finishColumns(columns, loadedColumns);
+        return;
+    }
+
+    statisticsCache_.load(statisticsKey_);
+    bool cacheChanged{false};
+    std::size_t index{0};
+    const auto fileColumnsCount{static_cast<Column>(loadedColumns.size())};
+    for (Column column = 0;
+         column < fileColumnsCount && index < columns.size(); ++column)
+    {
+        if (!loadedColumns[column])
+            continue;
+
+        DataColumn& dataColumn{columns[index++]};
+        const auto [found, entry] = statisticsCache_.get(column);
+        const bool fits{found &&
+                        entry.columnType_ == dataColumn.getColumnType() &&
+                        entry.rowCount_ == rowCount()};
+        if (fits &&
+            dataColumn.finishFilling(entry.distinctCount_, entry.sortedCodes_))
+            continue;
+
+        if (!fits)
+            dataColumn.finishFilling();
+        statisticsCache_.insert(
+            column, {dataColumn.getColumnType(), rowCount(),
+                     dataColumn.getStatistics().distinctCount_,
+                     dataColumn.getSortedCodes()});
+        cacheChanged = true;
+    }
+
+    if (cacheChanged && !statisticsCache_.save())
+        LOG(LogTypes::IMPORT_EXPORT,
+            "Can not save statistics cache of " + getName() + ".");
+}
+
+unsigned int DatasetInner::getBufferedRowCount() const
+{
+    // Both formats are read straight into columns.
+    return 0;
+}
+
+std::tuple<bool, QVector<QVector<QVariant>>> DatasetInner::getColumnarSample()
+{
+    QVector<QVector<QVariant>> data{prepareContainerForSampleData()};
+    const auto rows{static_cast<int>(data.size())};
+    RowSelection selection;
+    if (rows > 0)
+        selection.blocks_.append(0);
+    selection.rowCount_ = rows;
+    for (Column column = 0; column < static_cast<int>(columnCount()); ++column)
+    {
+        DataColumn dataColumn(getColumnFormat(column), rows);
+        if (!readColumn(column, selection, dataColumn))
+            return {false, {}};
+        for (int row = 0; row < rows; ++row)
+            data[row][column] = getSampleVariant(dataColumn, row);
+    }
+    return {true, data};
 }
 
-void DatasetInner::updateProgress(unsigned int currentRow,
-                                  unsigned int rowCount,
-                                  unsigned int& lastEmittedPercent)
+int DatasetInner::getBlockCount(unsigned int rows) const
 {
-    const unsigned int currentPercent{
-        static_cast<unsigned int>(100. * (currentRow + 1) / rowCount)};
-    if (currentPercent > lastEmittedPercent)
+    return static_cast<int>((rows + blockRows_ - 1) / blockRows_);
+}
+
+int DatasetInner::getBlockRowCount(int block) const
+{
+    const unsigned int firstRow{static_cast<unsigned int>(block) * blockRows_};
+    return static_cast<int>(std::min(blockRows_, fileRowCount_ - firstRow));
+}
+
+std::tuple<bool, DatasetInner::RowSelection> DatasetInner::selectRows()
+{
+    RowSelection selection;
+    if (loadFilter_.isEmpty())
+    {
+        for (int block = 0; block < getBlockCount(rowCount()); ++block)
+            selection.blocks_.append(block);
+        selection.rowCount_ = static_cast<int>(rowCount());
+        return {true, selection};
+    }
+
+    const Column column{loadFilter_.getColumn()};
+    if (column >= static_cast<Column>(columnCount()) ||
+        getColumnFormat(column) != loadFilter_.getColumnType())
+    {
+        LOG(LogTypes::IMPORT_EXPORT,
+            "Load filter does not fit column " + QString::number(column) +
+                ".");
+        return {false, {}};
+    }
+
+    QBitArray matchingCodes;
+    if (loadFilter_.getColumnType() == ColumnType::STRING)
+    {
+        auto [success, dictionary] = readDictionary(column);
+        if (!success)
+            return {false, {}};
+        matchingCodes = loadFilter_.getMatchingCodes(dictionary);
+    }
+
+    RowSelection candidates;
+    bool success{false};
+    std::tie(success, candidates.blocks_) =
+        findCandidateBlocks(column, matchingCodes);
+    for (const int block : candidates.blocks_)
+        candidates.rowCount_ += getBlockRowCount(block);
+    QBitArray matchingRows;
+    if (!success ||
+        !matchRows(column, candidates, matchingCodes, matchingRows))
+        return {false, {}};
+
+    // Rows beyond limit set using limitRows() are not matching.
+    int candidateRow{0};
+    for (const int block : candidates.blocks_)
+    {
+        const unsigned int firstRow{static_cast<unsigned int>(block) *
+                                    blockRows_};
+        const int blockRows{getBlockRowCount(block)};
+        for (int row = 0; row < blockRows; ++row)
+            if (firstRow + static_cast<unsigned int>(row) >= rowCount())
+                matchingRows.clearBit(candidateRow + row);
+        candidateRow += blockRows;
+    }
+
+    // Candidate blocks without matching rows are skipped for other columns.
+    int position{0};
+    QVector<int> positions;
+    int selectedBlocksRows{0};
+    for (const int block : candidates.blocks_)
+    {
+        const int blockRows{getBlockRowCount(block)};
+        int matched{0};
+        for (int row = position; row < position + blockRows; ++row)
+            matched += matchingRows.testBit(row) ? 1 : 0;
+        if (matched > 0)
+        {
+            selection.blocks_.append(block);
+            positions.append(position);
+            selection.rowCount_ += matched;
+            selectedBlocksRows += blockRows;
+        }
+        position += blockRows;
+    }
+
+    selection.rows_.resize(selectedBlocksRows);
+    int selectedRow{0};
+    for (int i = 0; i < selection.blocks_.size(); ++i)
     {
-        Q_EMIT loadingPercentChanged(currentPercent);
-        lastEmittedPercent = currentPercent;
-        QCoreApplication::processEvents();
+        const int blockRows{getBlockRowCount(selection.blocks_[i])};
+        for (int row = 0; row < blockRows; ++row)
+            selection.rows_.setBit(selectedRow + row,
+                                   matchingRows.testBit(positions[i] + row));
+        selectedRow += blockRows;
     }
+
+    LOG(LogTypes::IMPORT_EXPORT,
+        "Load filter selected " + QString::number(selection.rowCount_) +
+            " rows in " + QString::number(selection.blocks_.size()) + " of " +
+            QString::number(getBlockCount(fileRowCount_)) + " blocks.");
+    return {true, selection};
 }
 
-QVariant DatasetInner::getElementAsVariant(ColumnType columnFormat,
-                                           const QString& element)
+std::tuple<bool, QVector<int>> DatasetInner::findCandidateBlocks(
+    Column column, const QBitArray& matchingCodes)
 {
-    QVariant elementAsVariant;
-    if (element.isEmpty())
-        elementAsVariant = getDefaultVariantForFormat(columnFormat);
-    else
+    QuaZipFile zipFile(&zip_);
+    zip_.setCurrentFile(DatasetUtilities::getDatasetZonesFilename(column));
+    if (!openQuaZipFile(zipFile))
+        return {false, {}};
+
+    // Each zone has count of rows with values followed by minimum and
+    // maximum for numbers and dates or count and list of present codes for
+    // strings.
+    const QByteArray content{zipFile.readAll()};
+    const char* current{content.constData()};
+    const char* end{current + content.size()};
+    const bool anyCodeMatches{matchingCodes.count(true) > 0};
+    QVector<int> blocks;
+    const int limitedBlockCount{getBlockCount(rowCount())};
+    for (int block = 0; block < getBlockCount(fileRowCount_); ++block)
     {
-        switch (columnFormat)
+        quint32 validRows{0};
+        bool mayMatch{false};
+        switch (loadFilter_.getColumnType())
         {
             case ColumnType::NUMBER:
-                elementAsVariant = QVariant(element.toDouble());
+            {
+                double min{0.};
+                double max{0.};
+                if (!readLittleEndian(current, end, validRows) ||
+                    !readLittleEndian(current, end, min) ||
+                    !readLittleEndian(current, end, max))
+                    return {false, {}};
+                mayMatch = loadFilter_.mayMatch(min, max);
                 break;
+            }
 
-            case ColumnType::STRING:
-                elementAsVariant = QVariant(element.toInt());
+            case ColumnType::DATE:
+            {
+                qint32 min{0};
+                qint32 max{0};
+                if (!readLittleEndian(current, end, validRows) ||
+                    !readLittleEndian(current, end, min) ||
+                    !readLittleEndian(current, end, max))
+                    return {false, {}};
+                mayMatch = loadFilter_.mayMatch(min, max);
                 break;
+            }
 
-            case ColumnType::DATE:
-                elementAsVariant =
-                    QVariant(QDate::fromJulianDay(element.toInt()));
+            case ColumnType::STRING:
+            {
+                quint32 codesCount{0};
+                if (!readLittleEndian(current, end, validRows) ||
+                    !readLittleEndian(current, end, codesCount))
+                    return {false, {}};
+                if (codesCount == COLUMNAR_ZONE_ANY_CODE)
+                {
+                    mayMatch = anyCodeMatches;
+                    break;
+                }
+                for (quint32 i = 0; i < codesCount; ++i)
+                {
+                    quint32 code{0};
+                    if (!readLittleEndian(current, end, code))
+                        return {false, {}};
+                    if (static_cast<qsizetype>(code) < matchingCodes.size() &&
+                        matchingCodes.testBit(code))
+                        mayMatch = true;
+                }
                 break;
+            }
 
             case ColumnType::UNKNOWN:
-                Q_ASSERT(false);
-                elementAsVariant = QVariant(QMetaType(QMetaType::QString));
-                break;
+                return {false, {}};
         }
+
+        if (validRows > 0 && mayMatch && block < limitedBlockCount)
+            blocks.append(block);
     }
-    return elementAsVariant;
+    return {true, blocks};
 }
 
-QVariant DatasetInner::getDefaultVariantForFormat(ColumnType format)
+bool DatasetInner::matchRows(Column column, const RowSelection& candidates,
+                             const QBitArray& matchingCodes,
+                             QBitArray& matchingRows)
 {
-    switch (format)
+    QBitArray validity;
+    matchingRows = QBitArray(candidates.rowCount_);
+    switch (loadFilter_.getColumnType())
     {
-        case ColumnType::STRING:
-            return QVariant(QMetaType(QMetaType::Int));
-
         case ColumnType::NUMBER:
-            return QVariant(QMetaType(QMetaType::Double));
+        {
+            QVector<double> numbers(candidates.rowCount_);
+            if (!readValues(column, candidates, numbers.data(), validity))
+                return false;
+            for (int row = 0; row < candidates.rowCount_; ++row)
+                if (validity.testBit(row) && loadFilter_.matches(numbers[row]))
+                    matchingRows.setBit(row);
+            return true;
+        }
 
         case ColumnType::DATE:
-            return QVariant(QMetaType(QMetaType::QDate));
+        {
+            QVector<qint32> julianDays(candidates.rowCount_);
+            if (!readValues(column, candidates, julianDays.data(), validity))
+                return false;
+            for (int row = 0; row < candidates.rowCount_; ++row)
+                if (validity.testBit(row) &&
+                    loadFilter_.matches(julianDays[row]))
+                    matchingRows.setBit(row);
+            return true;
+        }
+
+        case ColumnType::STRING:
+        {
+            QVector<quint32> codes(candidates.rowCount_);
+            if (!readValues(column, candidates, codes.data(), validity))
+                return false;
+            for (int row = 0; row < candidates.rowCount_; ++row)
+            {
+                const auto code{static_cast<qsizetype>(codes[row])};
+                if (validity.testBit(row) && code < matchingCodes.size() &&
+                    matchingCodes.testBit(code))
+                    matchingRows.setBit(row);
+            }
+            return true;
+        }
 
         case ColumnType::UNKNOWN:
-            return QVariant(QMetaType(QMetaType::QString));
+            break;
     }
-    return QVariant(QMetaType(QMetaType::QString));
+    return false;
 }
 
-QVector<QVariant> DatasetInner::fillRow(const QStringList& line,
-                                        bool fillSamplesOnly)
+bool DatasetInner::readColumn(Column column, const RowSelection& selection,
+                              DataColumn& dataColumn)
 {
-    QVector<QVariant> row;
-    for (Column column = 0; column < static_cast<int>(columnCount()); ++column)
+    // Values are read straight into column, which can be backed by spill file.
+    QBitArray validity;
+    switch (dataColumn.getColumnType())
     {
-        if (!fillSamplesOnly && !activeColumns_[column])
-            continue;
+        case ColumnType::NUMBER:
+        {
+            if (!readValues(column, selection,
+                            reinterpret_cast<double*>(
+                                dataColumn.getValuesForFilling()),
+                            validity))
+                return false;
+            dataColumn.setValidity(std::move(validity));
+            return true;
+        }
+
+        case ColumnType::DATE:
+        {
+            if (!readValues(column, selection,
+                            reinterpret_cast<qint32*>(
+                                dataColumn.getValuesForFilling()),
+                            validity))
+                return false;
+            dataColumn.setValidity(std::move(validity));
+            return true;
+        }
+
+        case ColumnType::STRING:
+        {
+            auto [success, dictionary] = readDictionary(column);
+            // Codes narrower than 4 bytes need buffer to be converted.
+            QVector<quint32> codesBuffer;
+            auto* codes{
+                reinterpret_cast<quint32*>(dataColumn.getValuesForFilling())};
+            if (codes == nullptr)
+            {
+                codesBuffer.resize(selection.rowCount_);
+                codes = codesBuffer.data();
+            }
+            if (!success || !readValues(column, selection, codes, validity))
+                return false;
+            for (int row = 0; row < selection.rowCount_; ++row)
+            {
+                if (validity.testBit(row) &&
+                    codes[row] >= static_cast<quint32>(dictionary.size()))
+                {
+                    LOG(LogTypes::IMPORT_EXPORT,
+                        "Wrong string code in column " +
+                            QString::number(column) + ".");
+                    return false;
+                }
+            }
+            const bool allRowsLoaded{
+                selection.rows_.isEmpty() &&
+                selection.rowCount_ == static_cast<int>(fileRowCount_)};
+            if (!allRowsLoaded)
+                compactDictionary(dictionary, codes, validity);
+            dataColumn.setStrings(std::move(dictionary), codes,
+                                  std::move(validity));
+            return true;
+        }
 
-        const QString& element{line.at(column)};
-        row.append(getElementAsVariant(getColumnFormat(column), element));
+        case ColumnType::UNKNOWN:
+            break;
     }
-    return row;
+    return false;
 }
 
-QVector<QVector<QVariant>> DatasetInner::parseData(QTextStream& stream,
-                                                   bool fillSamplesOnly)
+template <typename T>
+bool DatasetInner::readValues(Column column, const RowSelection& selection,
+                              T* values, QBitArray& validity)
 {
-    unsigned int lastEmittedPercent{0};
-    unsigned int lineCounter{0};
-    QVector<QVector<QVariant>> data{fillSamplesOnly
-                                        ? prepareContainerForSampleData()
-                                        : prepareContainerForAllData()};
-    while (!stream.atEnd() && lineCounter < rowCount())
+    validity = QBitArray(selection.rowCount_);
+    const bool allRows{selection.rows_.isEmpty()};
+    int position{0};
+    int target{0};
+    QVector<T> blockValues;
+    QBitArray blockValidity;
+    for (const int block : selection.blocks_)
     {
-        if (fillSamplesOnly && lineCounter >= SAMPLE_SIZE)
-            break;
+        const int blockRows{getBlockRowCount(block)};
+        if (allRows)
+        {
+            // Values are read in place, only rows needed for sample are read.
+            const int rows{std::min(blockRows, selection.rowCount_ - target)};
+            T* destination{values + target};
+            if (!readColumnBlock(column, block, blockValidity,
+                                 reinterpret_cast<char*>(destination),
+                                 sizeof(T), rows))
+                return false;
+            qFromLittleEndian<T>(destination, rows, destination);
+            for (int row = 0; row < rows; ++row)
+                if (blockValidity.testBit(row))
+                    validity.setBit(target + row);
+            target += rows;
+            continue;
+        }
 
-        const QStringList line{stream.readLine().split(';')};
-        data[static_cast<int>(lineCounter)] = fillRow(line, fillSamplesOnly);
-        if (!fillSamplesOnly)
-            updateProgress(lineCounter, rowCount(), lastEmittedPercent);
-        lineCounter++;
+        blockValues.resize(blockRows);
+        if (!readColumnBlock(column, block, blockValidity,
+                             reinterpret_cast<char*>(blockValues.data()),
+                             sizeof(T), blockRows))
+            return false;
+        qFromLittleEndian<T>(blockValues.constData(), blockRows,
+                             blockValues.data());
+        for (int row = 0; row < blockRows; ++row)
+        {
+            if (!selection.rows_.testBit(position + row))
+                continue;
+            values[target] = blockValues[row];
+            validity.setBit(target, blockValidity.testBit(row));
+            ++target;
+        }
+        position += blockRows;
     }
-    return data;
+    return true;
 }
 
-std::tuple<bool, QVector<QVector<QVariant>>> DatasetInner::fillData(
-    QuaZip& zip, bool fillSamplesOnly)
+bool DatasetInner::readColumnBlock(Column column, int block,
+                                   QBitArray& validity, char* values,
+                                   qint64 valueSize, int rows)
 {
-    QuaZipFile zipFile(&zip);
-    zip.setCurrentFile(DatasetUtilities::getDatasetDataFilename());
+    QuaZipFile zipFile(&zip_);
+    zip_.setCurrentFile(
+        DatasetUtilities::getDatasetColumnFilename(column, block));
     if (!openQuaZipFile(zipFile))
-        return {false, {}};
+        return false;
 
-    QTextStream stream(&zipFile);
-    stream.setEncoding(QStringConverter::Utf8);
-    const QVector<QVector<QVariant>> data{parseData(stream, fillSamplesOnly)};
-    LOG(LogTypes::IMPORT_EXPORT,
-        "Loaded " + QString::number(data.size()) + " rows.");
+    // Validity bitmap of all rows of block in file is followed by values.
+    const qint64 bitsInByte{8};
+    const qint64 firstRow{static_cast<qint64>(block) * blockRows_};
+    const qint64 fileBlockRows{
+        std::min<qint64>(blockRows_, fileRowCount_ - firstRow)};
+    QByteArray validityBits(
+        static_cast<qsizetype>((fileBlockRows + bitsInByte - 1) / bitsInByte),
+        Qt::Uninitialized);
+    if (!readBytes(zipFile, validityBits.data(), validityBits.size()) ||
+        !readBytes(zipFile, values, valueSize * rows))
+    {
+        LOG(LogTypes::IMPORT_EXPORT,
+            "File " + zip_.getCurrentFileName() + " is corrupted.");
+        return false;
+    }
 
-    return {true, data};
+    validity = QBitArray::fromBits(validityBits.constData(), rows);
+    return true;
 }
 
-QVector<QVector<QVariant>> DatasetInner::prepareContainerForAllData() const
+std::tuple<bool, QStringList> DatasetInner::readDictionary(Column column)
 {
-    QVector<QVector<QVariant>> data;
-    data.resize(static_cast<int>(rowCount()));
-    const qsizetype activeColumnsCount{activeColumns_.size()};
-    for (auto& row : data)
-        row.resize(activeColumnsCount);
-    return data;
+    QuaZipFile zipFile(&zip_);
+    zip_.setCurrentFile(DatasetUtilities::getDatasetDictionaryFilename(column));
+    if (!openQuaZipFile(zipFile))
+        return {false, {}};
+
+    // Count of strings followed by size and UTF-8 bytes of each string.
+    const QByteArray content{zipFile.readAll()};
+    const char* current{content.constData()};
+    const char* end{current + content.size()};
+    const auto sizeOfNumber{static_cast<qsizetype>(sizeof(quint32))};
+    if (end - current < sizeOfNumber)
+        return {false, {}};
+    const auto count{qFromLittleEndian<quint32>(current)};
+    current += sizeOfNumber;
+
+    QStringList dictionary;
+    dictionary.reserve(static_cast<qsizetype>(
+        std::min<quint32>(count, static_cast<quint32>(content.size()))));
+    for (quint32 i = 0; i < count; ++i)
+    {
+        if (end - current < sizeOfNumber)
+            return {false, {}};
+        const auto size{
+            static_cast<qsizetype>(qFromLittleEndian<quint32>(current))};
+        current += sizeOfNumber;
+        if (end - current < size)
+            return {false, {}};
+        dictionary.append(StringInterner::getInstance().decode(
+            QByteArrayView(current, size)));
+        current += size;
+    }
+    return {true, dictionary};
 }
 
-QVector<QVector<QVariant>> DatasetInner::prepareContainerForSampleData() const
+bool DatasetInner::readBytes(QIODevice& device, char* destination,
+                             qint64 size)
 {
-    QVector<QVector<QVariant>> data;
-    const int rowsCountForSamples =
-        static_cast<int>((rowCount() > SAMPLE_SIZE ? SAMPLE_SIZE : rowCount()));
-    data.resize(rowsCountForSamples);
-    for (int i = 0; i < rowsCountForSamples; ++i)
-        data[i].resize(static_cast<int>(columnsCount_));
-    return data;
+    while (size > 0)
+    {
+        const qint64 read{device.read(destination, size)};
+        if (read <= 0)
+            return false;
+        destination += read;
+        size -= read;
+    }
+    return true;
 }
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <atomic>
+
+#include "DataBlockQueue.h"
 #include "Dataset.h"
+#include "InnerLineTokenizer.h"
+#include "StatisticsCache.h"
 
 #include <quazip/quazip.h>
 
 class QuaZipFile;
-class QTextStream;
 
 /**
  * @class DatasetInner
@@ -17,20 +21,48 @@ class DatasetInner : public Dataset
 public:
     explicit DatasetInner(const QString& name, QObject* parent = nullptr);
 
+    /**
+     * @brief Constructor for .vbx file kept outside of datasets dir.
+     * @param name Name of dataset.
+     * @param filePath Path of .vbx file.
+     * @param parent Parent object.
+     */
+    DatasetInner(const QString& name, const QString& filePath,
+                 QObject* parent = nullptr);
+
+    /**
+     * @brief Read only definition of dataset without strings and sample.
+     * Column names, types, tagged columns and row count are set afterwards,
+     * data can not be loaded.
+     * @return True if succeed, false otherwise.
+     */
+    bool readDefinition();
+
 protected:
     std::tuple<bool, QVector<QVector<QVariant>>> getSample() override;
 
-    std::tuple<bool, QVector<QVector<QVariant>>> getAllData() override;
+    bool pushAllData() override;
 
     bool analyze() override;
 
     void closeZip() override;
 
+    bool isColumnar() const override;
+
+    std::tuple<bool, std::vector<DataColumn>> getAllColumns() override;
+
+    void finishColumns(std::vector<DataColumn>& columns,
+                       const QVector<bool>& loadedColumns) override;
+
+    unsigned int getBufferedRowCount() const override;
+
 private:
     bool openZip();
 
     static bool openQuaZipFile(QuaZipFile& zipFile);
 
+    bool loadDefinition();
+
     void retrieveColumnsFromXml(const QDomElement& root);
 
     void checkForTaggedColumn(const QDomElement& columnElement, Column column);
@@ -41,27 +73,92 @@ private:
 
     bool loadStrings(QuaZip& zip);
 
-    QVector<QVariant> fillRow(const QStringList& line, bool fillSamplesOnly);
+    QVector<QVector<QVariant>> parseSampleData(QIODevice& device) const;
 
-    QVector<QVector<QVariant>> parseData(QTextStream& stream,
-                                         bool fillSamplesOnly);
+    unsigned int readBlocks(QIODevice& device, DataBlockQueue& queue,
+                            const std::atomic<bool>& outOfMemory);
 
-    std::tuple<bool, QVector<QVector<QVariant>>> fillData(QuaZip& zip,
-                                                          bool fillSamplesOnly);
+    /**
+     * @brief Parse rows of block and write their values straight into
+     * pushed columns. Blocks cover different rows, so many threads can fill
+     * columns at once.
+     * @param block Block of data file.
+     * @param tokenizer Tokenizer of lines.
+     * @param values Values of pushed columns, string indexes for strings.
+     * @param nulls Rows of null values of each pushed column, appended.
+     */
+    void fillBlock(const DataBlock& block, const InnerLineTokenizer& tokenizer,
+                   const QVector<char*>& values,
+                   QVector<QVector<int>>& nulls) const;
 
-    void updateProgress(unsigned int currentRow, unsigned int rowCount,
-                        unsigned int& lastEmittedPercent);
+    void parseAllData(QIODevice& device);
 
-    static QVariant getElementAsVariant(ColumnType columnFormat,
-                                        const QString& element);
+    bool openDataFile(QuaZipFile& zipFile);
 
-    static QVariant getDefaultVariantForFormat(ColumnType format);
+    QVector<QVector<QVariant>> prepareContainerForSampleData() const;
 
-    QVector<QVector<QVariant>> prepareContainerForAllData() const;
+    std::tuple<bool, QVector<QVector<QVariant>>> getColumnarSample();
 
-    QVector<QVector<QVariant>> prepareContainerForSampleData() const;
+    /// Blocks of columns to load and rows of those blocks to keep.
+    struct RowSelection
+    {
+        QVector<int> blocks_;
+
+        /// Bits for all rows of selected blocks, empty to keep all rows.
+        QBitArray rows_;
+
+        int rowCount_{0};
+    };
+
+    /// Number of blocks of file holding given number of first rows.
+    int getBlockCount(unsigned int rows) const;
+
+    /// Number of rows of block in file.
+    int getBlockRowCount(int block) const;
+
+    std::tuple<bool, RowSelection> selectRows();
+
+    std::tuple<bool, QVector<int>> findCandidateBlocks(
+        Column column, const QBitArray& matchingCodes);
+
+    bool matchRows(Column column, const RowSelection& candidates,
+                   const QBitArray& matchingCodes, QBitArray& matchingRows);
+
+    bool readColumn(Column column, const RowSelection& selection,
+                    DataColumn& dataColumn);
+
+    /// Values of selected rows are written to memory for selection row count.
+    template <typename T>
+    bool readValues(Column column, const RowSelection& selection, T* values,
+                    QBitArray& validity);
+
+    bool readColumnBlock(Column column, int block, QBitArray& validity,
+                         char* values, qint64 valueSize, int rows);
+
+    std::tuple<bool, QStringList> readDictionary(Column column);
+
+    static bool readBytes(QIODevice& device, char* destination, qint64 size);
 
     QuaZip zip_;
 
-    const QString datasetsDir_;
+    /// Layout of file read from definition.
+    DatasetFormat format_{DatasetFormat::TEXT};
+
+    /// Number of rows stored in file, rowCount() can be lower.
+    unsigned int fileRowCount_{0};
+
+    /// Number of rows in blocks of columns in COLUMNAR format.
+    unsigned int blockRows_{COLUMNAR_BLOCK_ROWS};
+
+    /// Statistics saved by earlier loads of file.
+    StatisticsCache statisticsCache_;
+
+    /// Key identifying content of file in statistics cache.
+    QByteArray statisticsKey_;
+
+    /// Size of inflated blocks of data file passed to parsing threads.
+    static constexpr qint64 BLOCK_SIZE{1024 * 1024};
+
+    /// Maximum time of waiting for parsing threads between progress updates.
+    static constexpr int PROGRESS_INTERVAL_MS{50};
 };
@@ -1,5 +1,7 @@
 #include "DatasetOds.h"
 
+#include <limits>
+
 #include <ImportOds.h>
 
 DatasetOds::DatasetOds(const QString& name, const QString& zipFileName,
@@ -14,3 +16,28 @@ bool DatasetOds::loadSpecificData()
     // Nothing specific for .ods.
     return true;
 }
+
+std::tuple<bool, SpreadsheetSampler::Sample> DatasetOds::readSample(
+    const QString& sheetName, unsigned int rowLimit) const
+{
+    return SpreadsheetSampler::readOds(zipFile_.fileName(), sheetName,
+                                       rowLimit);
+}
+
+std::tuple<bool, DatasetSpreadsheet::SheetXml> DatasetOds::prepareSheetXml(
+    const QString& sheetName)
+{
+    // Writers put name as first attribute of table, other layouts are read
+    // by importer.
+    const QByteArray tableStart{"<table:table table:name=\"" +
+                                sheetName.toHtmlEscaped().toUtf8() + "\""};
+    return {true,
+            {QStringLiteral("content.xml"), tableStart, "</table:table-row>",
+             "</table:table>"}};
+}
+
+QVector<QVector<QVariant>> DatasetOds::parseRows(QXmlStreamReader& xml) const
+{
+    return SpreadsheetSampler::parseOdsRows(
+        xml, std::numeric_limits<qsizetype>::max());
+}
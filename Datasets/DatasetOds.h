@@ -15,4 +15,12 @@ public:
 
 protected:
     bool loadSpecificData() override;
+
+    std::tuple<bool, SpreadsheetSampler::Sample> readSample(
+        const QString& sheetName, unsigned int rowLimit) const override;
+
+    std::tuple<bool, SheetXml> prepareSheetXml(
+        const QString& sheetName) override;
+
+    QVector<QVector<QVariant>> parseRows(QXmlStreamReader& xml) const override;
 };
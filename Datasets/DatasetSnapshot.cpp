@@ -0,0 +1,16 @@
+#include "DatasetSnapshot.h"
+
+DatasetSnapshot::DatasetSnapshot(std::vector<DataColumn> columns)
+    : columns_(std::move(columns))
+{
+}
+
+int DatasetSnapshot::rowCount() const
+{
+    return columns_.empty() ? 0 : columns_.front().rowCount();
+}
+
+int DatasetSnapshot::columnCount() const
+{
+    return static_cast<int>(columns_.size());
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <vector>
+
+#include "DataColumn.h"
+
+/**
+ * @class DatasetSnapshot
+ * @brief Immutable columns of loaded dataset.
+ * Created once loading is finished and shared using shared_ptr. Nothing is
+ * modified after construction, so snapshot can be read from many threads at
+ * once without locking. Snapshot stays valid after dataset is destroyed.
+ */
+class DatasetSnapshot
+{
+public:
+    /**
+     * @brief DatasetSnapshot constructor.
+     * @param columns Filled columns.
+     */
+    explicit DatasetSnapshot(std::vector<DataColumn> columns);
+
+    DatasetSnapshot& operator=(const DatasetSnapshot& other) = delete;
+    DatasetSnapshot(const DatasetSnapshot& other) = delete;
+
+    DatasetSnapshot& operator=(DatasetSnapshot&& other) = delete;
+    DatasetSnapshot(DatasetSnapshot&& other) = delete;
+
+    ~DatasetSnapshot() = default;
+
+    /**
+     * @brief Get number of rows.
+     * @return Number of rows.
+     */
+    int rowCount() const;
+
+    /**
+     * @brief Get number of columns.
+     * @return Number of columns.
+     */
+    int columnCount() const;
+
+    /**
+     * @brief Get column with typed values, dictionary and validity bitmap.
+     * @param column Column index.
+     * @return Column.
+     */
+    inline const DataColumn& getColumn(int column) const
+    {
+        return columns_[static_cast<std::size_t>(column)];
+    }
+
+private:
+    const std::vector<DataColumn> columns_;
+};
@@ -1,6 +1,46 @@
 #include "DatasetSpreadsheet.h"
 
+#include <atomic>
+#include <new>
+
+#include <quazip/quazip.h>
+#include <quazip/quazipfile.h>
+#include <QThread>
+#include <QXmlStreamReader>
+
+#include <Constants.h>
 #include <Logger.h>
+#include <MemoryUtilities.h>
+
+#include "SheetXmlSplitter.h"
+
+namespace
+{
+/// Check that parsed cell is stored the same way importer would store it.
+bool cellFitsColumnType(const QVariant& cell, ColumnType columnType)
+{
+    if (cell.isNull())
+        return true;
+
+    switch (columnType)
+    {
+        case ColumnType::NUMBER:
+            return cell.typeId() == QMetaType::Double;
+
+        case ColumnType::DATE:
+            return cell.typeId() == QMetaType::QDate;
+
+        case ColumnType::STRING:
+            // Integers are indexes of shared strings of .xlsx files.
+            return cell.typeId() == QMetaType::QString ||
+                   cell.typeId() == QMetaType::Int;
+
+        case ColumnType::UNKNOWN:
+            break;
+    }
+    return false;
+}
+}  // namespace
 
 DatasetSpreadsheet::DatasetSpreadsheet(const QString& name,
                                        const QString& zipFileName,
@@ -11,7 +51,10 @@ DatasetSpreadsheet::DatasetSpreadsheet(const QString& name,
 
 bool DatasetSpreadsheet::analyze()
 {
-    importer_->setNameForEmptyColumn(QObject::tr("no name"));
+    if (fastAnalysisRows_ > 0)
+        return analyzeSample();
+
+    importer_->setNameForEmptyColumn(getNameForEmptyColumn());
     QObject::connect(importer_.get(),
                      &ImportSpreadsheet::progressPercentChanged, this,
                      &Dataset::loadingPercentChanged);
@@ -28,13 +71,75 @@ bool DatasetSpreadsheet::analyze()
     return true;
 }
 
-const QString& DatasetSpreadsheet::getSheetName()
+QString DatasetSpreadsheet::getFilePath() const
+{
+    return zipFile_.fileName();
+}
+
+bool DatasetSpreadsheet::isWholeSheetLoaded() const
+{
+    return !rowsLimited_ && !activeColumns_.contains(false);
+}
+
+void DatasetSpreadsheet::enableFastAnalysis(unsigned int sampledRows)
+{
+    fastAnalysisRows_ = sampledRows;
+}
+
+bool DatasetSpreadsheet::analyzeSample()
+{
+    if (!getSheetList())
+        return false;
+
+    auto [success, sample] = readSample(getSheetName(), fastAnalysisRows_);
+    if (!success || sample.columnNames_.isEmpty())
+    {
+        LOG(LogTypes::IMPORT_EXPORT,
+            "Can not read first rows of sheet " + getSheetName() + ".");
+        return false;
+    }
+
+    for (QString& columnName : sample.columnNames_)
+        if (columnName.isEmpty())
+            columnName = getNameForEmptyColumn();
+    headerColumnNames_ = std::move(sample.columnNames_);
+    columnTypes_ = std::move(sample.columnTypes_);
+    sampledRows_ = std::move(sample.rows_);
+    columnsCount_ = static_cast<unsigned int>(columnTypes_.size());
+    rowsCount_ = static_cast<unsigned int>(sampledRows_.size());
+
+    valid_ = true;
+
+    return true;
+}
+
+QString DatasetSpreadsheet::getNameForEmptyColumn()
+{
+    return QObject::tr("no name");
+}
+
+void DatasetSpreadsheet::setSheetName(const QString& sheetName)
+{
+    sheetName_ = sheetName;
+}
+
+const QString& DatasetSpreadsheet::getSheetName() const
 {
-    return sheetNames_.constFirst();
+    return sheetName_.isEmpty() ? sheetNames_.constFirst() : sheetName_;
+}
+
+std::tuple<bool, QStringList> DatasetSpreadsheet::readSheetNames()
+{
+    if (!getSheetList())
+        return {false, {}};
+    return {true, sheetNames_};
 }
 
 std::tuple<bool, QVector<QVector<QVariant>>> DatasetSpreadsheet::getSample()
 {
+    if (fastAnalysisRows_ > 0)
+        return {true, sampledRows_.mid(0, SAMPLE_SIZE)};
+
     auto [success, data] = getDataFromZip(getSheetName(), true);
     if (!success)
         return {false, {}};
@@ -43,14 +148,47 @@ std::tuple<bool, QVector<QVector<QVariant>>> DatasetSpreadsheet::getSample()
     return {true, data};
 }
 
-std::tuple<bool, QVector<QVector<QVariant>>> DatasetSpreadsheet::getAllData()
+bool DatasetSpreadsheet::pushAllData()
 {
-    if (!isValid())
-        return {false, {}};
+    if (!isValid() || fastAnalysisRows_ > 0)
+        return false;
+
+    if (parseAllData())
+    {
+        LOG(LogTypes::IMPORT_EXPORT,
+            "Loaded file having " + QString::number(rowsCount_) + " rows.");
+        return true;
+    }
+    if (isLoadingCancelled())
+        return false;
 
+    // Layouts not handled by parallel parsing are read by importer.
+    LOG(LogTypes::IMPORT_EXPORT,
+        "Can not parse sheet " + getSheetName() + " in parallel.");
+
+    // Importer keeps whole sheet as rows of variants, unlike parallel
+    // parsing which was admitted using estimateMemoryUsage().
+    const quint64 neededMemory{estimateRowsMemoryUsage(rowCount())};
+    const quint64 availableMemory{MemoryUtilities::getAvailableMemory()};
+    if (availableMemory != 0 && neededMemory > availableMemory)
+    {
+        error_ = QObject::tr("Not enough memory to import sheet ") +
+                 getSheetName() + ".";
+        LOG(LogTypes::MEMORY,
+            "Importer needs about " +
+                Constants::bytesToMegabytes(neededMemory) + " MB, available " +
+                Constants::bytesToMegabytes(availableMemory) + " MB.");
+        return false;
+    }
+
+    prepareColumnsForPushing();
+
+    // Importer returns whole sheet and can not be interrupted, rows are
+    // released while stored.
     QVector<QVector<QVariant>> data;
     std::tie(valid_, data) = getDataFromZip(getSheetName(), false);
-    return {valid_, data};
+    pushRows(data);
+    return valid_ && !isLoadingCancelled();
 }
 
 void DatasetSpreadsheet::closeZip()
@@ -64,8 +202,21 @@ bool DatasetSpreadsheet::getSheetList()
     bool success{false};
     std::tie(success, sheetNames_) = importer_->getSheetNames();
     if (!success)
+    {
         LOG(LogTypes::IMPORT_EXPORT, importer_->getLastError());
-    return success;
+        return false;
+    }
+
+    if (sheetName_.isEmpty() ? sheetNames_.isEmpty()
+                             : !sheetNames_.contains(sheetName_))
+    {
+        error_ = QObject::tr("Sheet ") + sheetName_ +
+                 QObject::tr(" not found in file ") + zipFile_.fileName() +
+                 ".";
+        LOG(LogTypes::IMPORT_EXPORT, error_);
+        return false;
+    }
+    return true;
 }
 
 bool DatasetSpreadsheet::getHeadersList(const QString& sheetName)
@@ -107,8 +258,12 @@ std::tuple<bool, QVector<QVector<QVariant>>> DatasetSpreadsheet::getDataFromZip(
              ++column)
             if (!activeColumns_.at(column))
                 excludedColumns.append(static_cast<unsigned int>(column));
-        std::tie(success, data) =
-            importer_->getData(sheetName, excludedColumns);
+        if (rowsLimited_)
+            std::tie(success, data) = importer_->getLimitedData(
+                sheetName, excludedColumns, rowCount());
+        else
+            std::tie(success, data) =
+                importer_->getData(sheetName, excludedColumns);
     }
 
     if (!success)
@@ -126,3 +281,161 @@ std::tuple<bool, QVector<QVector<QVariant>>> DatasetSpreadsheet::getDataFromZip(
 
     return {true, data};
 }
+
+bool DatasetSpreadsheet::parseAllData()
+{
+    const auto [prepared, sheetXml] = prepareSheetXml(getSheetName());
+    if (!prepared)
+        return false;
+
+    QuaZip zip(zipFile_.fileName());
+    if (!zip.open(QuaZip::mdUnzip) || !zip.setCurrentFile(sheetXml.fileName_))
+        return false;
+    QuaZipFile zipFile(&zip);
+    if (!zipFile.open(QIODevice::ReadOnly))
+        return false;
+    SheetXmlSplitter splitter(zipFile, sheetXml.rowsStart_, sheetXml.rowEnd_,
+                              sheetXml.rowsEnd_);
+    if (!splitter.findRows())
+        return false;
+
+    QVector<int> activeColumns;
+    for (Column column = 0; column < static_cast<Column>(columnCount());
+         ++column)
+        if (activeColumns_.at(column))
+            activeColumns.append(column);
+
+    const int parsersCount{std::max(1, QThread::idealThreadCount() - 1)};
+    DataBlockQueue queue(2 * parsersCount);
+    ParsedBlocks parsedBlocks;
+    std::atomic<bool> failed{false};
+    std::vector<std::unique_ptr<QThread>> parsers;
+    for (int i = 0; i < parsersCount; ++i)
+    {
+        parsers.emplace_back(QThread::create(
+            [this, &queue, &parsedBlocks, &activeColumns, &failed]()
+            {
+                // Exception leaving thread would terminate application.
+                try
+                {
+                    DataBlock block;
+                    while (queue.pop(block))
+                    {
+                        auto [parsed, rows] = parseBlock(block, activeColumns);
+                        if (!parsed)
+                            failed = true;
+                        parsedBlocks.add(block.firstRow_, std::move(rows));
+                    }
+                }
+                catch (const std::bad_alloc&)
+                {
+                    parsedBlocks.setOutOfMemory();
+                    queue.close();
+                }
+            }));
+        parsers.back()->start();
+    }
+
+    // Blocks are numbered instead of rows, number of rows in block is known
+    // only after parsing it. Inflating and storing rows on this thread
+    // overlaps with parsing. Blocks not stored yet are limited to queue
+    // capacity, also when many wait for slower earlier one.
+    unsigned int blocksCount{0};
+    unsigned int nextBlock{0};
+    unsigned int pushedRows{0};
+    unsigned int lastEmittedPercent{0};
+    const auto window{static_cast<unsigned int>(queue.getCapacity())};
+    try
+    {
+        DataBlock block;
+        while (!failed && !isLoadingCancelled() &&
+               !parsedBlocks.isOutOfMemory() &&
+               (!rowsLimited_ || pushedRows < rowCount()) &&
+               splitter.readBlock(block.bytes_))
+        {
+            block.firstRow_ = blocksCount++;
+            while (blocksCount - 1 - nextBlock >= window ||
+                   !queue.tryPush(block, 0))
+            {
+                if (parsedBlocks.isOutOfMemory())
+                    break;
+                pushNextBlock(parsedBlocks, nextBlock, pushedRows,
+                              PROGRESS_INTERVAL_MS, lastEmittedPercent);
+            }
+            while (pushNextBlock(parsedBlocks, nextBlock, pushedRows, 0,
+                                 lastEmittedPercent))
+            {
+            }
+        }
+        queue.close();
+        while (nextBlock < blocksCount && !failed && !isLoadingCancelled() &&
+               !parsedBlocks.isOutOfMemory())
+            pushNextBlock(parsedBlocks, nextBlock, pushedRows,
+                          PROGRESS_INTERVAL_MS, lastEmittedPercent);
+    }
+    catch (const std::bad_alloc&)
+    {
+        parsedBlocks.setOutOfMemory();
+    }
+    queue.close();
+    for (const auto& parser : parsers)
+        parser->wait();
+
+    // Reported on loading thread, where caller handles lack of memory.
+    if (parsedBlocks.isOutOfMemory())
+        throw std::bad_alloc();
+
+    // Importer counts rows differently for some layouts, e.g. empty rows.
+    const bool rowsMatch{rowsLimited_ ? pushedRows >= rowCount()
+                                      : pushedRows == rowCount()};
+    return !failed && !splitter.hasError() && rowsMatch &&
+           !isLoadingCancelled();
+}
+
+std::tuple<bool, QVector<QVector<QVariant>>> DatasetSpreadsheet::parseBlock(
+    const DataBlock& block, const QVector<int>& activeColumns) const
+{
+    QXmlStreamReader xml(block.bytes_);
+    QVector<QVector<QVariant>> rows{parseRows(xml)};
+    if (xml.hasError())
+        return {false, {}};
+
+    // Header is first row of first block.
+    if (block.firstRow_ == 0 && !rows.isEmpty())
+        rows.removeFirst();
+
+    // Cells of other type than chosen by importer, e.g. numbers with date
+    // styles not recognized here, are left to importer.
+    for (auto& row : rows)
+    {
+        QVector<QVariant> activeCells(activeColumns.size());
+        for (qsizetype i = 0; i < activeColumns.size(); ++i)
+        {
+            const Column column{activeColumns[i]};
+            activeCells[i] = row.value(column);
+            if (!cellFitsColumnType(activeCells[i], columnTypes_[column]))
+                return {false, {}};
+        }
+        row = std::move(activeCells);
+    }
+    return {true, rows};
+}
+
+bool DatasetSpreadsheet::pushNextBlock(ParsedBlocks& parsedBlocks,
+                                       unsigned int& nextBlock,
+                                       unsigned int& pushedRows,
+                                       int timeoutMs,
+                                       unsigned int& lastEmittedPercent)
+{
+    QVector<QVector<QVariant>> rows;
+    if (!parsedBlocks.tryTake(nextBlock, rows, timeoutMs))
+        return false;
+
+    ++nextBlock;
+    pushedRows += static_cast<unsigned int>(rows.size());
+    pushRows(rows);
+    if (pushedRows > 0 && rowCount() > 0)
+        updateProgress(std::min(pushedRows, rowCount()) - 1, rowCount(),
+                       lastEmittedPercent);
+    return true;
+}
@@ -3,7 +3,12 @@
 #include <ImportSpreadsheet.h>
 #include <QFile>
 
+#include "DataBlockQueue.h"
 #include "Dataset.h"
+#include "ParsedBlocks.h"
+#include "SpreadsheetSampler.h"
+
+class QXmlStreamReader;
 
 /**
  * @class DatasetSpreadsheet
@@ -16,14 +21,94 @@ public:
     DatasetSpreadsheet(const QString& name, const QString& zipFileName,
                        QObject* parent = nullptr);
 
+    /**
+     * @brief Get path of spreadsheet file.
+     * @return File path.
+     */
+    QString getFilePath() const;
+
+    /**
+     * @brief Check if all columns and rows are chosen for loading, so loaded
+     * data represents whole sheet. Call before loading data.
+     * @return True if whole sheet is loaded, false otherwise.
+     */
+    bool isWholeSheetLoaded() const;
+
+    /**
+     * @brief Infer names and types of columns from first rows of sheet
+     * instead of letting importer scan whole sheet. Row count covers sampled
+     * rows only and data can not be loaded afterwards.
+     * @param sampledRows Number of rows read below header.
+     */
+    void enableFastAnalysis(unsigned int sampledRows);
+
+    /**
+     * @brief Choose sheet which is analysed and loaded. First sheet is used
+     * when no sheet is chosen. Call before initialize().
+     * @param sheetName Name of sheet.
+     */
+    void setSheetName(const QString& sheetName);
+
+    /**
+     * @brief Get name of sheet which is analysed and loaded. Valid after
+     * sheets were read.
+     * @return Name of sheet.
+     */
+    const QString& getSheetName() const;
+
+    /**
+     * @brief Read names of all sheets of file.
+     * @return Flag indicating success and names of sheets.
+     */
+    std::tuple<bool, QStringList> readSheetNames();
+
 protected:
     bool analyze() override;
 
     virtual bool loadSpecificData() = 0;
 
+    /**
+     * @brief Read first rows of sheet directly from file.
+     * @param sheetName Name of sheet.
+     * @param rowLimit Maximum number of rows read below header.
+     * @return Flag indicating success and sample.
+     */
+    virtual std::tuple<bool, SpreadsheetSampler::Sample> readSample(
+        const QString& sheetName, unsigned int rowLimit) const = 0;
+
+    /// Location of rows of sheet in XML file of spreadsheet.
+    struct SheetXml
+    {
+        /// Name of XML file inside zip.
+        QString fileName_;
+
+        /// Beginning of start tag of element containing rows of sheet.
+        QByteArray rowsStart_;
+
+        QByteArray rowEnd_;
+
+        QByteArray rowsEnd_;
+    };
+
+    /**
+     * @brief Find rows of sheet and prepare what parseRows() needs.
+     * @param sheetName Name of sheet.
+     * @return Flag indicating success and location of rows.
+     */
+    virtual std::tuple<bool, SheetXml> prepareSheetXml(
+        const QString& sheetName) = 0;
+
+    /**
+     * @brief Parse rows of block of sheet XML, called on many threads.
+     * @param xml Reader of block.
+     * @return Rows, header included when block is first one.
+     */
+    virtual QVector<QVector<QVariant>> parseRows(
+        QXmlStreamReader& xml) const = 0;
+
     std::tuple<bool, QVector<QVector<QVariant>>> getSample() override;
 
-    std::tuple<bool, QVector<QVector<QVariant>>> getAllData() override;
+    bool pushAllData() override;
 
     void closeZip() override;
 
@@ -31,13 +116,36 @@ protected:
     std::unique_ptr<ImportSpreadsheet> importer_{nullptr};
 
 private:
+    bool analyzeSample();
+
+    static QString getNameForEmptyColumn();
+
     bool getSheetList();
     bool getHeadersList(const QString& sheetName);
     bool getColumnTypes(const QString& sheetName);
     std::tuple<bool, QVector<QVector<QVariant>>> getDataFromZip(
         const QString& sheetName, bool fillSamplesOnly);
 
-    const QString& getSheetName();
+    bool parseAllData();
+
+    std::tuple<bool, QVector<QVector<QVariant>>> parseBlock(
+        const DataBlock& block, const QVector<int>& activeColumns) const;
+
+    bool pushNextBlock(ParsedBlocks& parsedBlocks, unsigned int& nextBlock,
+                       unsigned int& pushedRows, int timeoutMs,
+                       unsigned int& lastEmittedPercent);
 
     QStringList sheetNames_;
+
+    /// Chosen sheet, empty when first sheet is used.
+    QString sheetName_;
+
+    /// Number of rows read by fast analysis, 0 when whole sheet is analyzed.
+    unsigned int fastAnalysisRows_{0};
+
+    /// Rows read by fast analysis.
+    QVector<QVector<QVariant>> sampledRows_;
+
+    /// Maximum time of waiting for parsing threads between progress updates.
+    static constexpr int PROGRESS_INTERVAL_MS{50};
 };
@@ -1,7 +1,10 @@
 #include "DatasetXlsx.h"
 
+#include <limits>
+
 #include <ImportXlsx.h>
 #include <Logger.h>
+#include <quazip/quazip.h>
 
 DatasetXlsx::DatasetXlsx(const QString& name, const QString& zipFileName,
                          QObject* parent)
@@ -10,6 +13,18 @@ DatasetXlsx::DatasetXlsx(const QString& name, const QString& zipFileName,
     importer_ = std::make_unique<ImportXlsx>(zipFile_);
 }
 
+void DatasetXlsx::setSharedStrings(const StringsTable& sharedStrings)
+{
+    // Table is implicitly shared, strings are not copied.
+    sharedStrings_ = sharedStrings;
+    sharedStringsSet_ = true;
+}
+
+const StringsTable& DatasetXlsx::getSharedStrings() const
+{
+    return sharedStrings_;
+}
+
 bool DatasetXlsx::loadSharedStrings()
 {
     const auto [success, sharedStringsList] =
@@ -20,12 +35,15 @@ bool DatasetXlsx::loadSharedStrings()
         return false;
     }
     for (const auto& sharedString : sharedStringsList)
-        sharedStrings_.append(QVariant(sharedString));
+        sharedStrings_.append(sharedString.toUtf8());
     return success;
 }
 
 bool DatasetXlsx::loadSpecificData()
 {
+    if (sharedStringsSet_)
+        return true;
+
     if (!loadSharedStrings())
     {
         error_ = QObject::tr("File ") + zipFile_.fileName() +
@@ -35,3 +53,34 @@ bool DatasetXlsx::loadSpecificData()
 
     return true;
 }
+
+std::tuple<bool, SpreadsheetSampler::Sample> DatasetXlsx::readSample(
+    const QString& sheetName, unsigned int rowLimit) const
+{
+    return SpreadsheetSampler::readXlsx(zipFile_.fileName(), sheetName,
+                                        rowLimit);
+}
+
+std::tuple<bool, DatasetSpreadsheet::SheetXml> DatasetXlsx::prepareSheetXml(
+    const QString& sheetName)
+{
+    QuaZip zip(zipFile_.fileName());
+    if (!zip.open(QuaZip::mdUnzip))
+        return {false, {}};
+
+    const auto [found, sheetPath] =
+        SpreadsheetSampler::findXlsxSheetPath(zip, sheetName);
+    bool stylesRead{false};
+    std::tie(stylesRead, dateStyles_) =
+        SpreadsheetSampler::readXlsxDateStyles(zip);
+    if (!found || !stylesRead)
+        return {false, {}};
+
+    return {true, {sheetPath, "<sheetData", "</row>", "</sheetData>"}};
+}
+
+QVector<QVector<QVariant>> DatasetXlsx::parseRows(QXmlStreamReader& xml) const
+{
+    return SpreadsheetSampler::parseXlsxRows(
+        xml, dateStyles_, std::numeric_limits<qsizetype>::max());
+}
@@ -13,9 +13,37 @@ public:
     DatasetXlsx(const QString& name, const QString& zipFileName,
                 QObject* parent = nullptr);
 
+    /**
+     * @brief Use shared strings parsed for other sheet of the same file
+     * instead of parsing them again. Call before initialize().
+     * @param sharedStrings Shared strings of file.
+     */
+    void setSharedStrings(const StringsTable& sharedStrings);
+
+    /**
+     * @brief Get shared strings of file, available after analysis of whole
+     * sheet until data is loaded.
+     * @return Shared strings.
+     */
+    const StringsTable& getSharedStrings() const;
+
 protected:
     bool loadSpecificData() override;
 
+    std::tuple<bool, SpreadsheetSampler::Sample> readSample(
+        const QString& sheetName, unsigned int rowLimit) const override;
+
+    std::tuple<bool, SheetXml> prepareSheetXml(
+        const QString& sheetName) override;
+
+    QVector<QVector<QVariant>> parseRows(QXmlStreamReader& xml) const override;
+
 private:
     bool loadSharedStrings();
+
+    /// Flags of cell styles formatting dates, set by prepareSheetXml().
+    QVector<bool> dateStyles_;
+
+    /// Flag indicating that shared strings were set using setSharedStrings().
+    bool sharedStringsSet_{false};
 };
@@ -0,0 +1,96 @@
+#include "InnerLineTokenizer.h"
+
+#include <charconv>
+#include <cstring>
+#include <utility>
+
+#include <QDate>
+
+InnerLineTokenizer::InnerLineTokenizer(QVector<ColumnType> columnTypes,
+                                       QVector<bool> activeColumns)
+    : columnTypes_(std::move(columnTypes)),
+      activeColumns_(activeColumns.isEmpty()
+                         ? QVector<bool>(columnTypes_.size(), true)
+                         : std::move(activeColumns))
+{
+    for (int column = 0; column < columnTypes_.size(); ++column)
+    {
+        if (!activeColumns_[column])
+            continue;
+        lastActiveColumn_ = column;
+        ++activeColumnsCount_;
+    }
+}
+
+QVector<QVariant> InnerLineTokenizer::tokenize(const char* begin,
+                                               const char* end) const
+{
+    QVector<QVariant> row;
+    row.reserve(activeColumnsCount_);
+    const char* fieldBegin{begin};
+    for (int column = 0; column <= lastActiveColumn_; ++column)
+    {
+        const auto* separator{static_cast<const char*>(
+            std::memchr(fieldBegin, ';', end - fieldBegin))};
+        const char* fieldEnd{separator != nullptr ? separator : end};
+        if (activeColumns_[column])
+            row.append(toVariant(columnTypes_[column], fieldBegin, fieldEnd));
+        fieldBegin = (separator != nullptr ? separator + 1 : end);
+    }
+    return row;
+}
+
+QVariant InnerLineTokenizer::toVariant(ColumnType columnType,
+                                       const char* begin, const char* end)
+{
+    if (begin == end)
+        return getDefaultVariantForFormat(columnType);
+
+    switch (columnType)
+    {
+        case ColumnType::NUMBER:
+        {
+            double number{0.};
+            std::from_chars(begin, end, number);
+            return QVariant(number);
+        }
+
+        case ColumnType::STRING:
+        {
+            int stringCode{0};
+            std::from_chars(begin, end, stringCode);
+            return QVariant(stringCode);
+        }
+
+        case ColumnType::DATE:
+        {
+            qint64 julianDay{0};
+            std::from_chars(begin, end, julianDay);
+            return QVariant(QDate::fromJulianDay(julianDay));
+        }
+
+        case ColumnType::UNKNOWN:
+            Q_ASSERT(false);
+            break;
+    }
+    return QVariant(QMetaType(QMetaType::QString));
+}
+
+QVariant InnerLineTokenizer::getDefaultVariantForFormat(ColumnType format)
+{
+    switch (format)
+    {
+        case ColumnType::STRING:
+            return QVariant(QMetaType(QMetaType::Int));
+
+        case ColumnType::NUMBER:
+            return QVariant(QMetaType(QMetaType::Double));
+
+        case ColumnType::DATE:
+            return QVariant(QMetaType(QMetaType::QDate));
+
+        case ColumnType::UNKNOWN:
+            return QVariant(QMetaType(QMetaType::QString));
+    }
+    return QVariant(QMetaType(QMetaType::QString));
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <ColumnType.h>
+#include <QVariant>
+#include <QVector>
+
+/**
+ * @class InnerLineTokenizer
+ * @brief Tokenizer of lines of inner format data file. Works directly on
+ * UTF-8 bytes, fields of inactive columns are skipped without conversion.
+ */
+class InnerLineTokenizer
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param columnTypes Types of all columns in file.
+     * @param activeColumns Flags of columns to convert, empty for all.
+     */
+    InnerLineTokenizer(QVector<ColumnType> columnTypes,
+                       QVector<bool> activeColumns);
+
+    /**
+     * @brief Convert fields of active columns in line.
+     * @param begin First byte of line.
+     * @param end Byte after last one of line, new line is not included.
+     * @return Values of active columns.
+     */
+    QVector<QVariant> tokenize(const char* begin, const char* end) const;
+
+    /**
+     * @brief Convert single field.
+     * @param columnType Type of column.
+     * @param begin First byte of field.
+     * @param end Byte after last one of field.
+     * @return Value, string code for string column, null for empty field.
+     */
+    static QVariant toVariant(ColumnType columnType, const char* begin,
+                              const char* end);
+
+private:
+    static QVariant getDefaultVariantForFormat(ColumnType format);
+
+    const QVector<ColumnType> columnTypes_;
+
+    const QVector<bool> activeColumns_;
+
+    /// Fields after last active column are not scanned.
+    int lastActiveColumn_{-1};
+
+    qsizetype activeColumnsCount_{0};
+};
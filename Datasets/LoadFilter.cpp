@@ -0,0 +1,54 @@
+#include "LoadFilter.h"
+
+LoadFilter::LoadFilter(ColumnType columnType, int column)
+    : columnType_(columnType), column_(column)
+{
+}
+
+LoadFilter LoadFilter::createNumberFilter(int column, double from, double to)
+{
+    LoadFilter filter(ColumnType::NUMBER, column);
+    filter.from_ = from;
+    filter.to_ = to;
+    return filter;
+}
+
+LoadFilter LoadFilter::createDateFilter(int column, QDate from, QDate to)
+{
+    LoadFilter filter(ColumnType::DATE, column);
+    filter.from_ = static_cast<double>(from.toJulianDay());
+    filter.to_ = static_cast<double>(to.toJulianDay());
+    return filter;
+}
+
+LoadFilter LoadFilter::createStringFilter(int column, QStringList strings)
+{
+    LoadFilter filter(ColumnType::STRING, column);
+    filter.strings_ = std::move(strings);
+    return filter;
+}
+
+bool LoadFilter::isEmpty() const { return column_ == -1; }
+
+int LoadFilter::getColumn() const { return column_; }
+
+ColumnType LoadFilter::getColumnType() const { return columnType_; }
+
+bool LoadFilter::mayMatch(double min, double max) const
+{
+    return min <= to_ && max >= from_;
+}
+
+bool LoadFilter::matches(double value) const
+{
+    return value >= from_ && value <= to_;
+}
+
+QBitArray LoadFilter::getMatchingCodes(const QStringList& dictionary) const
+{
+    QBitArray codes(static_cast<qsizetype>(dictionary.size()));
+    for (qsizetype code = 0; code < dictionary.size(); ++code)
+        if (strings_.contains(dictionary[code]))
+            codes.setBit(code);
+    return codes;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <ColumnType.h>
+#include <QBitArray>
+#include <QDate>
+#include <QStringList>
+
+/**
+ * @class LoadFilter
+ * @brief Condition on values of one column checked while data is loaded.
+ * Only rows with value in range or set of filter are loaded, empty cells
+ * never match.
+ */
+class LoadFilter
+{
+public:
+    /// Create filter accepting all rows.
+    LoadFilter() = default;
+
+    /**
+     * @brief Create filter of numbers in closed range.
+     * @param column Index of number column.
+     * @param from Minimum accepted number.
+     * @param to Maximum accepted number.
+     * @return Filter.
+     */
+    static LoadFilter createNumberFilter(int column, double from, double to);
+
+    /**
+     * @brief Create filter of dates in closed range.
+     * @param column Index of date column.
+     * @param from First accepted date.
+     * @param to Last accepted date.
+     * @return Filter.
+     */
+    static LoadFilter createDateFilter(int column, QDate from, QDate to);
+
+    /**
+     * @brief Create filter of strings from given set.
+     * @param column Index of string column.
+     * @param strings Accepted strings.
+     * @return Filter.
+     */
+    static LoadFilter createStringFilter(int column, QStringList strings);
+
+    /**
+     * @brief Check if filter accepts all rows.
+     * @return True if filter is not set, false otherwise.
+     */
+    bool isEmpty() const;
+
+    int getColumn() const;
+
+    ColumnType getColumnType() const;
+
+    /**
+     * @brief Check if any value from given range can match filter. Used to
+     * skip blocks of rows using their minimum and maximum.
+     * @param min Minimum number or Julian day.
+     * @param max Maximum number or Julian day.
+     * @return True if range overlaps range of filter, false otherwise.
+     */
+    bool mayMatch(double min, double max) const;
+
+    /**
+     * @brief Check if number or Julian day matches filter.
+     * @param value Number or Julian day.
+     * @return True if value is in range of filter, false otherwise.
+     */
+    bool matches(double value) const;
+
+    /**
+     * @brief Get codes of strings from dictionary accepted by filter.
+     * @param dictionary Dictionary of string column.
+     * @return Bit array with bits set for codes of accepted strings.
+     */
+    QBitArray getMatchingCodes(const QStringList& dictionary) const;
+
+private:
+    LoadFilter(ColumnType columnType, int column);
+
+    ColumnType columnType_{ColumnType::UNKNOWN};
+
+    int column_{-1};
+
+    /// Range of numbers or Julian days.
+    double from_{0.};
+    double to_{0.};
+
+    QStringList strings_;
+};
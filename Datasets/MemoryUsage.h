@@ -0,0 +1,40 @@
+#pragma once
+
+#include <QtGlobal>
+
+/**
+ * @brief Number of bytes used by parts of loaded dataset.
+ */
+struct MemoryUsage
+{
+public:
+    /// Value arrays and validity bitmaps.
+    quint64 values_{0};
+
+    /// Dictionaries of string columns.
+    quint64 dictionaries_{0};
+
+    /// Strings table of source kept until data is loaded.
+    quint64 sharedStrings_{0};
+
+    /// Row mappings of proxy models.
+    quint64 proxyMappings_{0};
+
+    /// Values paged to spill files, not included in total().
+    quint64 spilled_{0};
+
+    inline quint64 total() const
+    {
+        return values_ + dictionaries_ + sharedStrings_ + proxyMappings_;
+    }
+
+    inline MemoryUsage& operator+=(const MemoryUsage& other)
+    {
+        values_ += other.values_;
+        dictionaries_ += other.dictionaries_;
+        sharedStrings_ += other.sharedStrings_;
+        proxyMappings_ += other.proxyMappings_;
+        spilled_ += other.spilled_;
+        return *this;
+    }
+};
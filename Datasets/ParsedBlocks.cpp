@@ -0,0 +1,45 @@
+#include "ParsedBlocks.h"
+
+#include <utility>
+
+#include <QDeadlineTimer>
+
+void ParsedBlocks::add(unsigned int firstRow, QVector<QVector<QVariant>> rows)
+{
+    const QMutexLocker locker(&mutex_);
+    blocks_.insert(firstRow, std::move(rows));
+    added_.wakeAll();
+}
+
+bool ParsedBlocks::tryTake(unsigned int firstRow,
+                           QVector<QVector<QVariant>>& rows, int timeoutMs)
+{
+    const QDeadlineTimer deadline(timeoutMs);
+    const QMutexLocker locker(&mutex_);
+    while (!blocks_.contains(firstRow))
+        if (outOfMemory_ || !added_.wait(&mutex_, deadline))
+            return false;
+
+    rows = blocks_.take(firstRow);
+    ++takenCount_;
+    return true;
+}
+
+unsigned int ParsedBlocks::getTakenCount() const
+{
+    const QMutexLocker locker(&mutex_);
+    return takenCount_;
+}
+
+void ParsedBlocks::setOutOfMemory()
+{
+    const QMutexLocker locker(&mutex_);
+    outOfMemory_ = true;
+    added_.wakeAll();
+}
+
+bool ParsedBlocks::isOutOfMemory() const
+{
+    const QMutexLocker locker(&mutex_);
+    return outOfMemory_;
+}
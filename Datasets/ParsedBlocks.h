@@ -0,0 +1,60 @@
+#pragma once
+
+#include <QMap>
+#include <QMutex>
+#include <QVariant>
+#include <QVector>
+#include <QWaitCondition>
+
+/**
+ * @class ParsedBlocks
+ * @brief Rows of data blocks parsed by many threads. Blocks can be added in
+ * any order and are taken in order of rows. Thread-safe.
+ */
+class ParsedBlocks
+{
+public:
+    /**
+     * @brief Add rows of parsed block.
+     * @param firstRow Row number of first row in block.
+     * @param rows Parsed rows.
+     */
+    void add(unsigned int firstRow, QVector<QVector<QVariant>> rows);
+
+    /**
+     * @brief Take rows of block, waiting for it when not parsed yet.
+     * @param firstRow Row number of first row in block.
+     * @param rows Taken rows.
+     * @param timeoutMs Maximum time of waiting.
+     * @return True if block was taken, false on timeout or when memory
+     * ran out.
+     */
+    bool tryTake(unsigned int firstRow, QVector<QVector<QVariant>>& rows,
+                 int timeoutMs);
+
+    /**
+     * @brief Get number of blocks taken so far. Reader compares it with
+     * number of dispatched blocks to limit blocks kept in memory.
+     * @return Number of taken blocks.
+     */
+    unsigned int getTakenCount() const;
+
+    /**
+     * @brief Mark that thread parsing or storing blocks ran out of memory.
+     * Waiting for blocks ends, as missing ones will never be added.
+     */
+    void setOutOfMemory();
+
+    bool isOutOfMemory() const;
+
+private:
+    QMap<unsigned int, QVector<QVector<QVariant>>> blocks_;
+
+    unsigned int takenCount_{0};
+
+    bool outOfMemory_{false};
+
+    mutable QMutex mutex_;
+
+    QWaitCondition added_;
+};
@@ -0,0 +1,113 @@
+#include "SheetXmlSplitter.h"
+
+#include <algorithm>
+
+#include <QIODevice>
+
+SheetXmlSplitter::SheetXmlSplitter(QIODevice& device, QByteArray rowsStart,
+                                   QByteArray rowEnd, QByteArray rowsEnd)
+    : device_(device),
+      rowsStart_(std::move(rowsStart)),
+      rowEnd_(std::move(rowEnd)),
+      rowsEnd_(std::move(rowsEnd))
+{
+}
+
+bool SheetXmlSplitter::findRows()
+{
+    while (!findRootElement())
+        if (!readMore())
+            return false;
+
+    while (true)
+    {
+        const qsizetype start{buffer_.indexOf(rowsStart_)};
+        const qsizetype end{start == -1 ? -1 : buffer_.indexOf('>', start)};
+        if (end != -1)
+        {
+            // Sheet without rows has self-closing element.
+            finished_ = (buffer_.at(end - 1) == '/');
+            buffer_.remove(0, end + 1);
+            return true;
+        }
+
+        // Keep part of buffer which can begin searched tag.
+        if (start == -1)
+            buffer_.remove(0, std::max(qsizetype{0}, buffer_.size() -
+                                                         rowsStart_.size()));
+        if (!readMore())
+            return false;
+    }
+}
+
+bool SheetXmlSplitter::readBlock(QByteArray& block)
+{
+    if (finished_)
+        return false;
+
+    qsizetype blockEnd{-1};
+    while (blockEnd == -1)
+    {
+        const qsizetype rowsEnd{buffer_.indexOf(rowsEnd_)};
+        if (rowsEnd != -1)
+        {
+            finished_ = true;
+            blockEnd = rowsEnd;
+            break;
+        }
+
+        const qsizetype lastRowEnd{buffer_.size() >= BLOCK_SIZE
+                                       ? buffer_.lastIndexOf(rowEnd_)
+                                       : -1};
+        if (lastRowEnd != -1)
+            blockEnd = lastRowEnd + rowEnd_.size();
+        else if (!readMore())
+        {
+            finished_ = true;
+            error_ = true;
+            return false;
+        }
+    }
+
+    block = rootStart_ + buffer_.first(blockEnd) + rootEnd_;
+    buffer_.remove(0, blockEnd);
+    return true;
+}
+
+bool SheetXmlSplitter::hasError() const { return error_; }
+
+bool SheetXmlSplitter::readMore()
+{
+    const QByteArray inflated{device_.read(BLOCK_SIZE)};
+    buffer_.append(inflated);
+    return !inflated.isEmpty();
+}
+
+bool SheetXmlSplitter::findRootElement()
+{
+    // Declaration and comments before root element are skipped.
+    qsizetype position{buffer_.indexOf('<')};
+    while (position != -1 && position + 1 < buffer_.size())
+    {
+        const qsizetype end{buffer_.indexOf('>', position)};
+        if (end == -1)
+            return false;
+
+        const char next{buffer_.at(position + 1)};
+        if (next != '?' && next != '!')
+        {
+            rootStart_ = buffer_.sliced(position, end + 1 - position);
+            const QByteArray nameSeparators{" \t\r\n/>"};
+            qsizetype nameEnd{position + 1};
+            while (nameEnd < end && !nameSeparators.contains(buffer_[nameEnd]))
+                ++nameEnd;
+            rootEnd_ = "</" + buffer_.sliced(position + 1,
+                                             nameEnd - position - 1) +
+                       ">";
+            buffer_.remove(0, end + 1);
+            return true;
+        }
+        position = buffer_.indexOf('<', end);
+    }
+    return false;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <QByteArray>
+
+class QIODevice;
+
+/**
+ * @class SheetXmlSplitter
+ * @brief Splits XML file of sheet into blocks of whole rows. Each block is
+ * wrapped in root element of file, so blocks are well formed and can be
+ * parsed independently on many threads.
+ */
+class SheetXmlSplitter
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param device Inflated XML file containing sheet.
+     * @param rowsStart Beginning of start tag of element containing rows.
+     * @param rowEnd End tag of row.
+     * @param rowsEnd End tag of element containing rows.
+     */
+    SheetXmlSplitter(QIODevice& device, QByteArray rowsStart,
+                     QByteArray rowEnd, QByteArray rowsEnd);
+
+    /**
+     * @brief Read file till rows of sheet.
+     * @return True if rows were found, false otherwise.
+     */
+    bool findRows();
+
+    /**
+     * @brief Read next block of whole rows, starting after findRows().
+     * @param block Block wrapped in root element.
+     * @return True if block was read, false at end of rows or on error.
+     */
+    bool readBlock(QByteArray& block);
+
+    /**
+     * @brief Check if file ended before end of rows.
+     * @return True on error, false otherwise.
+     */
+    bool hasError() const;
+
+private:
+    bool readMore();
+
+    bool findRootElement();
+
+    QIODevice& device_;
+
+    const QByteArray rowsStart_;
+
+    const QByteArray rowEnd_;
+
+    const QByteArray rowsEnd_;
+
+    /// Start tag of root element, declaring namespaces used by rows.
+    QByteArray rootStart_;
+
+    QByteArray rootEnd_;
+
+    /// Inflated data not passed in blocks yet.
+    QByteArray buffer_;
+
+    bool finished_{false};
+
+    bool error_{false};
+
+    /// Minimal size of block, blocks end after last row ending in block.
+    static constexpr qint64 BLOCK_SIZE{1024 * 1024};
+};
@@ -0,0 +1,162 @@
+#include "SpreadsheetCache.h"
+
+#include <algorithm>
+
+#include <quazip/quazip.h>
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+
+#include <DatasetUtilities.h>
+#include <Logger.h>
+
+#include "StatisticsCache.h"
+
+SpreadsheetCache::SpreadsheetCache(QString directory, quint64 sizeLimit)
+    : directory_(std::move(directory)),
+      indexFilePath_(directory_ + QStringLiteral("index")),
+      sizeLimit_(sizeLimit)
+{
+    QDir().mkpath(directory_);
+    loadIndex();
+}
+
+QString SpreadsheetCache::computeKey(const QString& filePath,
+                                     const QString& sheetName)
+{
+    QuaZip zip(filePath);
+    if (!zip.open(QuaZip::mdUnzip))
+        return {};
+
+    // Same spreadsheet copied to other place is converted again.
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(QFileInfo(filePath).absoluteFilePath().toUtf8());
+    hash.addData(sheetName.toUtf8());
+    hash.addData(StatisticsCache::computeKey(zip));
+    zip.close();
+    return QString::fromLatin1(hash.result().toHex());
+}
+
+QString SpreadsheetCache::getFilePath(const QString& key) const
+{
+    return directory_ + key + DatasetUtilities::getDatasetExtension();
+}
+
+QString SpreadsheetCache::getPartialFilePath(const QString& key) const
+{
+    return getFilePath(key) + QStringLiteral(".part");
+}
+
+bool SpreadsheetCache::contains(const QString& key) const
+{
+    return lastUsed_.contains(key);
+}
+
+void SpreadsheetCache::markUsed(const QString& key)
+{
+    lastUsed_[key] = QDateTime::currentMSecsSinceEpoch();
+    if (!saveIndex())
+        LOG(LogTypes::IMPORT_EXPORT,
+            "Can not save index of cache " + directory_ + ".");
+}
+
+bool SpreadsheetCache::insert(const QString& key,
+                              const QString& partialFilePath)
+{
+    removeFiles(key);
+    if (!QFile::rename(partialFilePath, getFilePath(key)))
+    {
+        QFile::remove(partialFilePath);
+        return false;
+    }
+
+    markUsed(key);
+    evict();
+    return contains(key);
+}
+
+void SpreadsheetCache::loadIndex()
+{
+    QFile file(indexFilePath_);
+    if (file.open(QIODevice::ReadOnly))
+    {
+        QDataStream stream(&file);
+        qint32 version{0};
+        stream >> version;
+        if (version == VERSION)
+            stream >> lastUsed_;
+        if (version != VERSION || stream.status() != QDataStream::Ok)
+        {
+            LOG(LogTypes::IMPORT_EXPORT,
+                "Index of cache " + directory_ + " is outdated, ignoring it.");
+            lastUsed_.clear();
+        }
+    }
+
+    // Files without entry in index are treated as least recently used.
+    const QDir directory(directory_);
+    QMap<QString, qint64> lastUsed;
+    const QFileInfoList files{directory.entryInfoList(
+        {"*" + DatasetUtilities::getDatasetExtension()}, QDir::Files)};
+    for (const QFileInfo& fileInfo : files)
+    {
+        const QString key{fileInfo.completeBaseName()};
+        lastUsed.insert(key, lastUsed_.value(key, 0));
+    }
+    lastUsed_ = std::move(lastUsed);
+}
+
+bool SpreadsheetCache::saveIndex() const
+{
+    QSaveFile file(indexFilePath_);
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    QDataStream stream(&file);
+    stream << VERSION << lastUsed_;
+    return stream.status() == QDataStream::Ok && file.commit();
+}
+
+void SpreadsheetCache::evict()
+{
+    QVector<QString> keys{lastUsed_.keys().toVector()};
+    std::sort(keys.begin(), keys.end(),
+              [this](const QString& left, const QString& right)
+              { return lastUsed_.value(left) < lastUsed_.value(right); });
+
+    quint64 size{0};
+    for (const QString& key : keys)
+        size += getSize(key);
+
+    for (const QString& key : keys)
+    {
+        if (size <= sizeLimit_)
+            break;
+        size -= std::min(size, getSize(key));
+        removeFiles(key);
+        lastUsed_.remove(key);
+        LOG(LogTypes::IMPORT_EXPORT,
+            "Removed " + key + " from cache " + directory_ + ".");
+    }
+    saveIndex();
+}
+
+void SpreadsheetCache::removeFiles(const QString& key) const
+{
+    QFile::remove(getFilePath(key));
+    QFile::remove(directory_ + key +
+                  DatasetUtilities::getDatasetStatisticsExtension());
+}
+
+quint64 SpreadsheetCache::getSize(const QString& key) const
+{
+    const QFileInfo dataFile(getFilePath(key));
+    const QFileInfo statisticsFile(
+        directory_ + key + DatasetUtilities::getDatasetStatisticsExtension());
+    return static_cast<quint64>(dataFile.size()) +
+           static_cast<quint64>(statisticsFile.size());
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <QMap>
+#include <QString>
+
+/**
+ * @class SpreadsheetCache
+ * @brief Spreadsheets converted to columnar .vbx files, reused when the same
+ * unchanged file is imported again. Least recently used files are removed
+ * when size of cache exceeds limit.
+ */
+class SpreadsheetCache
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param directory Directory of cached files, created when missing.
+     * @param sizeLimit Maximum size of cached files in bytes.
+     */
+    SpreadsheetCache(QString directory, quint64 sizeLimit);
+
+    /**
+     * @brief Compute key identifying sheet of spreadsheet using its path,
+     * size, modification time and hash of names and checksums of zipped files.
+     * @param filePath Path of spreadsheet.
+     * @param sheetName Name of sheet.
+     * @return Key usable as file name or empty string when file can not be
+     * opened.
+     */
+    static QString computeKey(const QString& filePath,
+                              const QString& sheetName);
+
+    /**
+     * @brief Get path of .vbx file for key.
+     * @param key Key of spreadsheet.
+     * @return File path.
+     */
+    QString getFilePath(const QString& key) const;
+
+    /**
+     * @brief Get path of file which can be written and passed to insert().
+     * @param key Key of spreadsheet.
+     * @return File path.
+     */
+    QString getPartialFilePath(const QString& key) const;
+
+    bool contains(const QString& key) const;
+
+    /**
+     * @brief Mark cached file as most recently used.
+     * @param key Key of spreadsheet.
+     */
+    void markUsed(const QString& key);
+
+    /**
+     * @brief Move written .vbx file into cache and remove least recently used
+     * files exceeding size limit.
+     * @param key Key of spreadsheet.
+     * @param partialFilePath Path returned by getPartialFilePath().
+     * @return True on success, false when file could not be moved or alone
+     * exceeds size limit.
+     */
+    bool insert(const QString& key, const QString& partialFilePath);
+
+private:
+    void loadIndex();
+
+    bool saveIndex() const;
+
+    void evict();
+
+    void removeFiles(const QString& key) const;
+
+    quint64 getSize(const QString& key) const;
+
+    const QString directory_;
+
+    /// File with times of last use of cached files.
+    const QString indexFilePath_;
+
+    const quint64 sizeLimit_;
+
+    /// Time of last use in ms since epoch for each key.
+    QMap<QString, qint64> lastUsed_;
+
+    /// Version of index layout, index with other version is dropped.
+    static constexpr qint32 VERSION{1};
+};
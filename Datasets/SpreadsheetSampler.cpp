@@ -0,0 +1,514 @@
+#include "SpreadsheetSampler.h"
+
+#include <algorithm>
+
+#include <quazip/quazip.h>
+#include <quazip/quazipfile.h>
+#include <QDate>
+#include <QHash>
+#include <QRegularExpression>
+#include <QXmlStreamReader>
+
+namespace
+{
+const QString tableNamespace{
+    QStringLiteral("urn:oasis:names:tc:opendocument:xmlns:table:1.0")};
+const QString officeNamespace{
+    QStringLiteral("urn:oasis:names:tc:opendocument:xmlns:office:1.0")};
+
+bool openZipEntry(QuaZip& zip, QuaZipFile& zipFile, const QString& name)
+{
+    return zip.setCurrentFile(name) && zipFile.open(QIODevice::ReadOnly);
+}
+
+int getIntAttribute(const QXmlStreamAttributes& attributes,
+                    const QString& namespaceUri, const QString& name,
+                    int defaultValue)
+{
+    bool ok{false};
+    const int value{attributes.value(namespaceUri, name).toInt(&ok)};
+    return ok ? value : defaultValue;
+}
+
+/// Read value of current <c> element, shared strings are returned as
+/// indexes.
+QVariant readXlsxCell(QXmlStreamReader& xml, const QVector<bool>& dateStyles)
+{
+    const QXmlStreamAttributes attributes{xml.attributes()};
+    const QString type{attributes.value(QStringLiteral("t")).toString()};
+    bool ok{false};
+    const int style{attributes.value(QStringLiteral("s")).toInt(&ok)};
+    const bool isDate{ok && style >= 0 && style < dateStyles.size() &&
+                      dateStyles[style]};
+
+    QString text;
+    while (xml.readNextStartElement())
+    {
+        if (xml.name() == QLatin1String("v"))
+            text = xml.readElementText();
+        else if (xml.name() == QLatin1String("is"))
+            text = xml.readElementText(
+                QXmlStreamReader::IncludeChildElements);
+        else
+            xml.skipCurrentElement();
+    }
+
+    if (text.isEmpty())
+        return {};
+
+    if (type == QLatin1String("s"))
+        return QVariant(text.toInt());
+
+    if (type == QLatin1String("str") || type == QLatin1String("inlineStr") ||
+        type == QLatin1String("e"))
+        return QVariant(text);
+
+    if (type == QLatin1String("d"))
+    {
+        const QDate date{QDate::fromString(text.left(10), Qt::ISODate)};
+        return date.isValid() ? QVariant(date) : QVariant(text);
+    }
+
+    const double value{text.toDouble(&ok)};
+    if (!ok)
+        return QVariant(text);
+
+    if (isDate)
+    {
+        const QDate excelEpoch(1899, 12, 30);
+        return QVariant(excelEpoch.addDays(static_cast<qint64>(value)));
+    }
+    return QVariant(value);
+}
+
+/// Read value of current <table:table-cell> element.
+QVariant readOdsCell(QXmlStreamReader& xml)
+{
+    const QXmlStreamAttributes attributes{xml.attributes()};
+    const QStringView valueType{
+        attributes.value(officeNamespace, QStringLiteral("value-type"))};
+    if (valueType.isEmpty())
+    {
+        xml.skipCurrentElement();
+        return {};
+    }
+
+    if (valueType == QLatin1String("float") ||
+        valueType == QLatin1String("percentage") ||
+        valueType == QLatin1String("currency"))
+    {
+        xml.skipCurrentElement();
+        bool ok{false};
+        const double value{
+            attributes.value(officeNamespace, QStringLiteral("value"))
+                .toDouble(&ok)};
+        return ok ? QVariant(value) : QVariant();
+    }
+
+    if (valueType == QLatin1String("date"))
+    {
+        xml.skipCurrentElement();
+        const QDate date{QDate::fromString(
+            attributes.value(officeNamespace, QStringLiteral("date-value"))
+                .left(10)
+                .toString(),
+            Qt::ISODate)};
+        return date.isValid() ? QVariant(date) : QVariant();
+    }
+
+    QStringList paragraphs;
+    while (xml.readNextStartElement())
+    {
+        if (xml.name() == QLatin1String("p"))
+            paragraphs.append(xml.readElementText(
+                QXmlStreamReader::IncludeChildElements));
+        else
+            xml.skipCurrentElement();
+    }
+    return QVariant(paragraphs.join(QLatin1Char('\n')));
+}
+
+void setCell(QVector<QVariant>& row, int column, const QVariant& value)
+{
+    if (row.size() <= column)
+        row.resize(column + 1);
+    row[column] = value;
+}
+}  // namespace
+
+std::tuple<bool, SpreadsheetSampler::Sample> SpreadsheetSampler::readXlsx(
+    const QString& filePath, const QString& sheetName, unsigned int rowLimit)
+{
+    QuaZip zip(filePath);
+    if (!zip.open(QuaZip::mdUnzip))
+        return {false, {}};
+
+    const auto [found, sheetPath] = findXlsxSheetPath(zip, sheetName);
+    if (!found)
+        return {false, {}};
+
+    const auto [stylesRead, dateStyles] = readXlsxDateStyles(zip);
+    if (!stylesRead)
+        return {false, {}};
+
+    auto [rowsRead, rows] =
+        readXlsxRows(zip, sheetPath, dateStyles, rowLimit);
+    if (!rowsRead || !resolveXlsxSharedStrings(zip, rows))
+        return {false, {}};
+
+    return {true, createSample(std::move(rows))};
+}
+
+std::tuple<bool, SpreadsheetSampler::Sample> SpreadsheetSampler::readOds(
+    const QString& filePath, const QString& sheetName, unsigned int rowLimit)
+{
+    QuaZip zip(filePath);
+    if (!zip.open(QuaZip::mdUnzip))
+        return {false, {}};
+
+    auto [success, rows] = readOdsRows(zip, sheetName, rowLimit);
+    if (!success)
+        return {false, {}};
+
+    return {true, createSample(std::move(rows))};
+}
+
+SpreadsheetSampler::Sample SpreadsheetSampler::createSample(
+    QVector<QVector<QVariant>> rows)
+{
+    Sample sample;
+    if (rows.isEmpty())
+        return sample;
+
+    qsizetype columnCount{0};
+    for (const auto& row : rows)
+        columnCount = std::max(columnCount, row.size());
+
+    const QVector<QVariant>& header{rows.constFirst()};
+    for (qsizetype column = 0; column < columnCount; ++column)
+        sample.columnNames_.append(
+            column < header.size() ? header[column].toString() : QString());
+
+    sample.columnTypes_ = QVector<ColumnType>(columnCount, ColumnType::UNKNOWN);
+    for (qsizetype rowIndex = 1; rowIndex < rows.size(); ++rowIndex)
+    {
+        QVector<QVariant>& row{rows[rowIndex]};
+        row.resize(columnCount);
+        for (qsizetype column = 0; column < columnCount; ++column)
+        {
+            if (row[column].isNull())
+                continue;
+            const ColumnType cellType{getCellType(row[column])};
+            ColumnType& columnType{sample.columnTypes_[column]};
+            if (columnType == ColumnType::UNKNOWN)
+                columnType = cellType;
+            else if (columnType != cellType)
+                columnType = ColumnType::STRING;
+        }
+        sample.rows_.append(std::move(row));
+    }
+
+    // Columns without values in sampled rows are treated as strings.
+    std::replace(sample.columnTypes_.begin(), sample.columnTypes_.end(),
+                 ColumnType::UNKNOWN, ColumnType::STRING);
+    return sample;
+}
+
+std::tuple<bool, QString> SpreadsheetSampler::findXlsxSheetPath(
+    QuaZip& zip, const QString& sheetName)
+{
+    QString relationId;
+    {
+        QuaZipFile zipFile(&zip);
+        if (!openZipEntry(zip, zipFile, QStringLiteral("xl/workbook.xml")))
+            return {false, {}};
+        QXmlStreamReader xml(&zipFile);
+        while (!xml.atEnd() && relationId.isEmpty())
+        {
+            xml.readNext();
+            if (!xml.isStartElement() || xml.name() != QLatin1String("sheet"))
+                continue;
+            const QXmlStreamAttributes attributes{xml.attributes()};
+            if (attributes.value(QStringLiteral("name")) != sheetName)
+                continue;
+            for (const QXmlStreamAttribute& attribute : attributes)
+                if (attribute.name() == QLatin1String("id"))
+                    relationId = attribute.value().toString();
+        }
+    }
+    if (relationId.isEmpty())
+        return {false, {}};
+
+    QuaZipFile zipFile(&zip);
+    if (!openZipEntry(zip, zipFile,
+                      QStringLiteral("xl/_rels/workbook.xml.rels")))
+        return {false, {}};
+    QXmlStreamReader xml(&zipFile);
+    while (!xml.atEnd())
+    {
+        xml.readNext();
+        if (!xml.isStartElement() ||
+            xml.name() != QLatin1String("Relationship") ||
+            xml.attributes().value(QStringLiteral("Id")) != relationId)
+            continue;
+        const QString target{
+            xml.attributes().value(QStringLiteral("Target")).toString()};
+        if (target.startsWith(QLatin1Char('/')))
+            return {true, target.mid(1)};
+        return {true, "xl/" + target};
+    }
+    return {false, {}};
+}
+
+std::tuple<bool, QVector<bool>> SpreadsheetSampler::readXlsxDateStyles(
+    QuaZip& zip)
+{
+    QuaZipFile zipFile(&zip);
+    if (!openZipEntry(zip, zipFile, QStringLiteral("xl/styles.xml")))
+        return {true, {}};
+
+    QHash<int, QString> customFormats;
+    QVector<int> cellFormats;
+    bool inCellFormats{false};
+    QXmlStreamReader xml(&zipFile);
+    while (!xml.atEnd())
+    {
+        xml.readNext();
+        if (xml.isEndElement() && xml.name() == QLatin1String("cellXfs"))
+            inCellFormats = false;
+        if (!xml.isStartElement())
+            continue;
+
+        const QXmlStreamAttributes attributes{xml.attributes()};
+        const int formatId{
+            getIntAttribute(attributes, {}, QStringLiteral("numFmtId"), 0)};
+        if (xml.name() == QLatin1String("numFmt"))
+            customFormats.insert(
+                formatId,
+                attributes.value(QStringLiteral("formatCode")).toString());
+        else if (xml.name() == QLatin1String("cellXfs"))
+            inCellFormats = true;
+        else if (inCellFormats && xml.name() == QLatin1String("xf"))
+            cellFormats.append(formatId);
+    }
+    if (xml.hasError())
+        return {false, {}};
+
+    QVector<bool> dateStyles;
+    dateStyles.reserve(cellFormats.size());
+    for (const int formatId : cellFormats)
+        dateStyles.append(
+            isXlsxDateFormat(formatId, customFormats.value(formatId)));
+    return {true, dateStyles};
+}
+
+std::tuple<bool, QVector<QVector<QVariant>>> SpreadsheetSampler::readXlsxRows(
+    QuaZip& zip, const QString& sheetPath, const QVector<bool>& dateStyles,
+    unsigned int rowLimit)
+{
+    QuaZipFile zipFile(&zip);
+    if (!openZipEntry(zip, zipFile, sheetPath))
+        return {false, {}};
+
+    // Header is read in addition to given number of rows.
+    QXmlStreamReader xml(&zipFile);
+    QVector<QVector<QVariant>> rows{parseXlsxRows(
+        xml, dateStyles, static_cast<qsizetype>(rowLimit) + 1)};
+    return {!xml.hasError(), rows};
+}
+
+QVector<QVector<QVariant>> SpreadsheetSampler::parseXlsxRows(
+    QXmlStreamReader& xml, const QVector<bool>& dateStyles,
+    qsizetype rowLimit)
+{
+    QVector<QVector<QVariant>> rows;
+    QVector<QVariant> row;
+    int nextColumn{0};
+    while (!xml.atEnd() && rows.size() < rowLimit)
+    {
+        xml.readNext();
+        if (xml.isEndElement() && xml.name() == QLatin1String("row"))
+            rows.append(std::move(row));
+        if (!xml.isStartElement())
+            continue;
+
+        if (xml.name() == QLatin1String("row"))
+        {
+            row = {};
+            nextColumn = 0;
+        }
+        else if (xml.name() == QLatin1String("c"))
+        {
+            const QString reference{
+                xml.attributes().value(QStringLiteral("r")).toString()};
+            const int column{reference.isEmpty()
+                                 ? nextColumn
+                                 : getXlsxColumnIndex(reference)};
+            nextColumn = column + 1;
+            const QVariant value{readXlsxCell(xml, dateStyles)};
+            if (!value.isNull() && column < MAX_COLUMNS)
+                setCell(row, column, value);
+        }
+    }
+    return rows;
+}
+
+bool SpreadsheetSampler::resolveXlsxSharedStrings(
+    QuaZip& zip, QVector<QVector<QVariant>>& rows)
+{
+    int maxIndex{-1};
+    for (const auto& row : rows)
+        for (const auto& cell : row)
+            if (cell.typeId() == QMetaType::Int)
+                maxIndex = std::max(maxIndex, cell.toInt());
+    if (maxIndex < 0)
+        return true;
+
+    // Strings are stored in order of first use, rows at top of sheet use
+    // ones at beginning of file.
+    QuaZipFile zipFile(&zip);
+    if (!openZipEntry(zip, zipFile, QStringLiteral("xl/sharedStrings.xml")))
+        return false;
+    QStringList strings;
+    QXmlStreamReader xml(&zipFile);
+    while (!xml.atEnd() && strings.size() <= maxIndex)
+    {
+        xml.readNext();
+        if (!xml.isStartElement() || xml.name() != QLatin1String("si"))
+            continue;
+
+        // Phonetic hints stored in <rPh> are not part of text.
+        QString text;
+        while (xml.readNextStartElement())
+        {
+            if (xml.name() == QLatin1String("t"))
+                text.append(xml.readElementText());
+            else if (xml.name() == QLatin1String("r"))
+                text.append(xml.readElementText(
+                    QXmlStreamReader::IncludeChildElements));
+            else
+                xml.skipCurrentElement();
+        }
+        strings.append(text);
+    }
+
+    for (auto& row : rows)
+        for (auto& cell : row)
+            if (cell.typeId() == QMetaType::Int)
+                cell = QVariant(strings.value(cell.toInt()));
+    return !xml.hasError();
+}
+
+std::tuple<bool, QVector<QVector<QVariant>>> SpreadsheetSampler::readOdsRows(
+    QuaZip& zip, const QString& sheetName, unsigned int rowLimit)
+{
+    QuaZipFile zipFile(&zip);
+    if (!openZipEntry(zip, zipFile, QStringLiteral("content.xml")))
+        return {false, {}};
+
+    QXmlStreamReader xml(&zipFile);
+    bool sheetFound{false};
+    while (!xml.atEnd() && !sheetFound)
+    {
+        xml.readNext();
+        sheetFound =
+            xml.isStartElement() && xml.namespaceUri() == tableNamespace &&
+            xml.name() == QLatin1String("table") &&
+            xml.attributes().value(tableNamespace, QStringLiteral("name")) ==
+                sheetName;
+    }
+    if (!sheetFound)
+        return {false, {}};
+
+    QVector<QVector<QVariant>> rows{
+        parseOdsRows(xml, static_cast<qsizetype>(rowLimit) + 1)};
+    return {!xml.hasError(), rows};
+}
+
+QVector<QVector<QVariant>> SpreadsheetSampler::parseOdsRows(
+    QXmlStreamReader& xml, qsizetype rowLimit)
+{
+    QVector<QVector<QVariant>> rows;
+    QVector<QVariant> row;
+    int column{0};
+    int rowRepeats{1};
+    while (!xml.atEnd() && rows.size() < rowLimit)
+    {
+        xml.readNext();
+        if (xml.isEndElement())
+        {
+            // Empty rows, often repeated till end of sheet, are skipped.
+            if (xml.name() == QLatin1String("table-row") && !row.isEmpty())
+                for (int i = 0; i < rowRepeats && rows.size() < rowLimit; ++i)
+                    rows.append(row);
+            if (xml.name() == QLatin1String("table"))
+                break;
+        }
+        if (!xml.isStartElement() || xml.namespaceUri() != tableNamespace)
+            continue;
+
+        const QXmlStreamAttributes attributes{xml.attributes()};
+        if (xml.name() == QLatin1String("table-row"))
+        {
+            row = {};
+            column = 0;
+            rowRepeats = getIntAttribute(
+                attributes, tableNamespace,
+                QStringLiteral("number-rows-repeated"), 1);
+        }
+        else if (xml.name() == QLatin1String("table-cell") ||
+                 xml.name() == QLatin1String("covered-table-cell"))
+        {
+            const int repeats{std::clamp(
+                getIntAttribute(attributes, tableNamespace,
+                                QStringLiteral("number-columns-repeated"), 1),
+                1, MAX_COLUMNS)};
+            const QVariant value{readOdsCell(xml)};
+            for (int i = 0; i < repeats && !value.isNull() &&
+                            column + i < MAX_COLUMNS;
+                 ++i)
+                setCell(row, column + i, value);
+            column = std::min(column + repeats, MAX_COLUMNS);
+        }
+    }
+    return rows;
+}
+
+bool SpreadsheetSampler::isXlsxDateFormat(int formatId,
+                                          const QString& formatCode)
+{
+    // Built in formats of dates, see ECMA-376 part 1, 18.8.30.
+    if ((formatId >= 14 && formatId <= 17) || formatId == 22)
+        return true;
+
+    // Quoted texts and sections like [Red] or [$-409] are not part of date.
+    static const QRegularExpression literals(
+        QStringLiteral("\"[^\"]*\"|\\[[^\\]]*\\]"));
+    const QString code{QString(formatCode).remove(literals).toLower()};
+    return code.contains(QLatin1Char('d')) || code.contains(QLatin1Char('y'));
+}
+
+int SpreadsheetSampler::getXlsxColumnIndex(const QString& cellReference)
+{
+    int column{0};
+    for (const QChar character : cellReference)
+    {
+        if (!character.isLetter())
+            break;
+        column = column * 26 + (character.toUpper().unicode() - 'A' + 1);
+    }
+    return column - 1;
+}
+
+ColumnType SpreadsheetSampler::getCellType(const QVariant& cell)
+{
+    switch (cell.typeId())
+    {
+        case QMetaType::Double:
+            return ColumnType::NUMBER;
+        case QMetaType::QDate:
+            return ColumnType::DATE;
+        default:
+            return ColumnType::STRING;
+    }
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <tuple>
+
+#include <ColumnType.h>
+#include <QStringList>
+#include <QVariant>
+#include <QVector>
+
+class QuaZip;
+class QXmlStreamReader;
+
+/**
+ * @class SpreadsheetSampler
+ * @brief Reads first rows of sheet directly from .xlsx or .ods file, so names
+ * and types of columns can be inferred without scanning whole sheet.
+ */
+class SpreadsheetSampler
+{
+public:
+    /// Columns inferred from header and rows read below it.
+    struct Sample
+    {
+        /// Names of columns, empty for columns without name in header.
+        QStringList columnNames_;
+
+        QVector<ColumnType> columnTypes_;
+
+        QVector<QVector<QVariant>> rows_;
+    };
+
+    /**
+     * @brief Read first rows of sheet of .xlsx file.
+     * @param filePath Path of .xlsx file.
+     * @param sheetName Name of sheet.
+     * @param rowLimit Maximum number of rows read below header.
+     * @return Flag indicating success and sample.
+     */
+    static std::tuple<bool, Sample> readXlsx(const QString& filePath,
+                                             const QString& sheetName,
+                                             unsigned int rowLimit);
+
+    /**
+     * @brief Read first rows of sheet of .ods file.
+     * @param filePath Path of .ods file.
+     * @param sheetName Name of sheet.
+     * @param rowLimit Maximum number of rows read below header.
+     * @return Flag indicating success and sample.
+     */
+    static std::tuple<bool, Sample> readOds(const QString& filePath,
+                                            const QString& sheetName,
+                                            unsigned int rowLimit);
+
+    /**
+     * @brief Create sample from rows of sheet. Column is of given type when
+     * all its non empty cells are of that type, otherwise it is string.
+     * @param rows Rows of sheet, first one is header. Rows can differ in size.
+     * @return Sample.
+     */
+    static Sample createSample(QVector<QVector<QVariant>> rows);
+
+    /**
+     * @brief Find XML file of sheet in .xlsx file.
+     * @param zip Opened .xlsx file.
+     * @param sheetName Name of sheet.
+     * @return Flag indicating success and path of file inside zip.
+     */
+    static std::tuple<bool, QString> findXlsxSheetPath(
+        QuaZip& zip, const QString& sheetName);
+
+    /**
+     * @brief Read which cell styles of .xlsx file format dates.
+     * @param zip Opened .xlsx file.
+     * @return Flag indicating success and flag for each cell style.
+     */
+    static std::tuple<bool, QVector<bool>> readXlsxDateStyles(QuaZip& zip);
+
+    /**
+     * @brief Read <row> elements of .xlsx sheet. Shared strings are returned
+     * as their indexes.
+     * @param xml Reader of sheet or of fragment containing whole rows.
+     * @param dateStyles Flags returned by readXlsxDateStyles().
+     * @param rowLimit Maximum number of rows read.
+     * @return Rows, reader should be checked for errors.
+     */
+    static QVector<QVector<QVariant>> parseXlsxRows(
+        QXmlStreamReader& xml, const QVector<bool>& dateStyles,
+        qsizetype rowLimit);
+
+    /**
+     * @brief Read <table:table-row> elements of .ods sheet till end of table.
+     * Empty rows are skipped.
+     * @param xml Reader of table or of fragment containing whole rows.
+     * @param rowLimit Maximum number of rows read.
+     * @return Rows, reader should be checked for errors.
+     */
+    static QVector<QVector<QVariant>> parseOdsRows(QXmlStreamReader& xml,
+                                                   qsizetype rowLimit);
+
+private:
+    static std::tuple<bool, QVector<QVector<QVariant>>> readXlsxRows(
+        QuaZip& zip, const QString& sheetPath, const QVector<bool>& dateStyles,
+        unsigned int rowLimit);
+
+    static bool resolveXlsxSharedStrings(QuaZip& zip,
+                                         QVector<QVector<QVariant>>& rows);
+
+    static std::tuple<bool, QVector<QVector<QVariant>>> readOdsRows(
+        QuaZip& zip, const QString& sheetName, unsigned int rowLimit);
+
+    static bool isXlsxDateFormat(int formatId, const QString& formatCode);
+
+    static int getXlsxColumnIndex(const QString& cellReference);
+
+    static ColumnType getCellType(const QVariant& cell);
+
+    /// Columns beyond this limit are ignored.
+    static constexpr int MAX_COLUMNS{16'384};
+};
@@ -0,0 +1,107 @@
+#include "StatisticsCache.h"
+
+#include <quazip/quazip.h>
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+
+#include <Logger.h>
+
+StatisticsCache::StatisticsCache(QString filePath)
+    : filePath_(std::move(filePath))
+{
+}
+
+QByteArray StatisticsCache::computeKey(QuaZip& zip)
+{
+    // Checksums stored in archive directory identify content without
+    // reading data of archive.
+    const QFileInfo fileInfo(zip.getZipName());
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    const QList<QuaZipFileInfo64> files{zip.getFileInfoList64()};
+    for (const QuaZipFileInfo64& file : files)
+    {
+        hash.addData(file.name.toUtf8());
+        hash.addData(QByteArray::number(file.crc));
+        hash.addData(QByteArray::number(file.uncompressedSize));
+    }
+
+    QByteArray key;
+    QDataStream stream(&key, QIODevice::WriteOnly);
+    stream << fileInfo.size()
+           << fileInfo.lastModified().toMSecsSinceEpoch() << hash.result();
+    return key;
+}
+
+void StatisticsCache::load(const QByteArray& key)
+{
+    key_ = key;
+    entries_.clear();
+    QFile file(filePath_);
+    if (!file.open(QIODevice::ReadOnly))
+        return;
+
+    QDataStream stream(&file);
+    qint32 version{0};
+    QByteArray savedKey;
+    stream >> version >> savedKey;
+    if (version != VERSION || savedKey != key_)
+    {
+        LOG(LogTypes::IMPORT_EXPORT,
+            "Cache " + filePath_ + " is outdated, ignoring it.");
+        return;
+    }
+
+    qint32 count{0};
+    stream >> count;
+    for (qint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i)
+    {
+        qint32 column{0};
+        quint8 columnType{0};
+        Entry entry;
+        stream >> column >> columnType >> entry.rowCount_ >>
+            entry.distinctCount_ >> entry.sortedCodes_;
+        entry.columnType_ = static_cast<ColumnType>(columnType);
+        entries_.insert(column, std::move(entry));
+    }
+
+    if (stream.status() != QDataStream::Ok)
+    {
+        LOG(LogTypes::IMPORT_EXPORT,
+            "Cache " + filePath_ + " is corrupted, ignoring it.");
+        entries_.clear();
+    }
+}
+
+bool StatisticsCache::save() const
+{
+    QSaveFile file(filePath_);
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    QDataStream stream(&file);
+    stream << VERSION << key_ << static_cast<qint32>(entries_.size());
+    for (auto it{entries_.cbegin()}; it != entries_.cend(); ++it)
+        stream << static_cast<qint32>(it.key())
+               << static_cast<quint8>(it.value().columnType_)
+               << it.value().rowCount_ << it.value().distinctCount_
+               << it.value().sortedCodes_;
+
+    return stream.status() == QDataStream::Ok && file.commit();
+}
+
+std::tuple<bool, StatisticsCache::Entry> StatisticsCache::get(int column) const
+{
+    const auto it{entries_.constFind(column)};
+    if (it == entries_.cend())
+        return {false, {}};
+    return {true, it.value()};
+}
+
+void StatisticsCache::insert(int column, Entry entry)
+{
+    entries_.insert(column, std::move(entry));
+}
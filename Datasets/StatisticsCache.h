@@ -0,0 +1,78 @@
+#pragma once
+
+#include <tuple>
+
+#include <ColumnType.h>
+#include <QByteArray>
+#include <QMap>
+#include <QString>
+#include <QVector>
+
+class QuaZip;
+
+/**
+ * @class StatisticsCache
+ * @brief Column statistics which are costly to compute, kept in file next to
+ * .vbx and reused when the same archive is loaded again.
+ */
+class StatisticsCache
+{
+public:
+    /// Statistics of single column of archive.
+    struct Entry
+    {
+        ColumnType columnType_{ColumnType::UNKNOWN};
+
+        unsigned int rowCount_{0};
+
+        unsigned int distinctCount_{0};
+
+        /// Dictionary codes in order of sorted strings.
+        QVector<quint32> sortedCodes_;
+    };
+
+    /**
+     * @brief Constructor.
+     * @param filePath Path of cache file.
+     */
+    explicit StatisticsCache(QString filePath);
+
+    /**
+     * @brief Compute key identifying content of archive using its size,
+     * modification time and hash of names and checksums of zipped files.
+     * @param zip Opened archive.
+     * @return Key.
+     */
+    static QByteArray computeKey(QuaZip& zip);
+
+    /**
+     * @brief Read entries from file. Entries saved for other key are dropped.
+     * @param key Key of archive.
+     */
+    void load(const QByteArray& key);
+
+    /**
+     * @brief Write entries to file.
+     * @return True on success, false otherwise.
+     */
+    bool save() const;
+
+    /**
+     * @brief Get entry of column.
+     * @param column Index of column in archive.
+     * @return Flag indicating entry was found and entry.
+     */
+    std::tuple<bool, Entry> get(int column) const;
+
+    void insert(int column, Entry entry);
+
+private:
+    const QString filePath_;
+
+    QByteArray key_;
+
+    QMap<int, Entry> entries_;
+
+    /// Version of file layout, cache with other version is dropped.
+    static constexpr qint32 VERSION{1};
+};
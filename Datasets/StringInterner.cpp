@@ -0,0 +1,97 @@
+#include "StringInterner.h"
+
+#include <QStringDecoder>
+
+StringInterner& StringInterner::getInstance()
+{
+    static StringInterner instance;
+    return instance;
+}
+
+QString StringInterner::intern(const QString& string)
+{
+    const QMutexLocker locker(&mutex_);
+    return internUnlocked(string);
+}
+
+void StringInterner::intern(QStringList& strings)
+{
+    const QMutexLocker locker(&mutex_);
+    for (QString& string : strings)
+        string = internUnlocked(string);
+}
+
+QString StringInterner::decode(QByteArrayView utf8) const
+{
+    // UTF-8 text never has less bytes than UTF-16 code units.
+    thread_local QString buffer;
+    buffer.resize(utf8.size());
+    QStringDecoder decoder(QStringDecoder::Utf8);
+    const QChar* end{decoder.appendToBuffer(buffer.data(), utf8)};
+    buffer.truncate(end - buffer.constData());
+
+    {
+        const QMutexLocker locker(&mutex_);
+        const auto it{references_.constFind(buffer)};
+        if (it != references_.cend())
+            return it.key();
+    }
+    return {buffer.constData(), buffer.size()};
+}
+
+void StringInterner::release(const QStringList& strings)
+{
+    const QMutexLocker locker(&mutex_);
+    for (const QString& string : strings)
+    {
+        auto it{references_.find(string)};
+        if (it == references_.end())
+            continue;
+        if (--it.value() == 0)
+            references_.erase(it);
+    }
+}
+
+int StringInterner::size() const
+{
+    const QMutexLocker locker(&mutex_);
+    return static_cast<int>(references_.size());
+}
+
+quint64 StringInterner::getMemoryUsage() const
+{
+    const QMutexLocker locker(&mutex_);
+    quint64 memoryUsage{0};
+    for (auto it{references_.cbegin()}; it != references_.cend(); ++it)
+        memoryUsage += getStringMemoryUsage(it.key());
+    return memoryUsage;
+}
+
+quint64 StringInterner::getMemoryShare(const QStringList& strings) const
+{
+    const QMutexLocker locker(&mutex_);
+    quint64 memoryShare{0};
+    for (const QString& string : strings)
+    {
+        const auto it{references_.constFind(string)};
+        if (it != references_.cend())
+            memoryShare += getStringMemoryUsage(it.key()) /
+                           static_cast<quint64>(it.value());
+    }
+    return memoryShare;
+}
+
+quint64 StringInterner::getStringMemoryUsage(const QString& string)
+{
+    return sizeof(QString) + sizeof(int) +
+           static_cast<quint64>(string.capacity()) * sizeof(QChar);
+}
+
+QString StringInterner::internUnlocked(const QString& string)
+{
+    auto it{references_.find(string)};
+    if (it == references_.end())
+        it = references_.insert(string, 0);
+    ++it.value();
+    return it.key();
+}
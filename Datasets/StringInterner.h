@@ -0,0 +1,88 @@
+#pragma once
+
+#include <QByteArrayView>
+#include <QHash>
+#include <QMutex>
+#include <QString>
+#include <QStringList>
+
+/**
+ * @class StringInterner
+ * @brief Process-wide, reference-counted pool of strings.
+ * Equal strings of all loaded datasets share single copy of data, so the
+ * same city or street names used in many tabs are stored once. Strings are
+ * removed from pool when last user releases them. Thread-safe.
+ */
+class StringInterner
+{
+public:
+    StringInterner& operator=(const StringInterner& other) = delete;
+    StringInterner(const StringInterner& other) = delete;
+
+    StringInterner& operator=(StringInterner&& other) = delete;
+    StringInterner(StringInterner&& other) = delete;
+
+    static StringInterner& getInstance();
+
+    /**
+     * @brief Get pooled copy of string. Each call needs matching release.
+     * @param string String owning its data.
+     * @return String sharing data with other pooled copies.
+     */
+    QString intern(const QString& string);
+
+    /**
+     * @brief Decode UTF-8 text, reusing data of pooled copy when there is
+     * one. Strings already used by other datasets are then not allocated
+     * again. No reference is taken, decoded string needs to be interned.
+     * @param utf8 Text to decode.
+     * @return Decoded string.
+     */
+    QString decode(QByteArrayView utf8) const;
+
+    /**
+     * @brief Replace strings with pooled copies.
+     * @param strings Strings to intern.
+     */
+    void intern(QStringList& strings);
+
+    /**
+     * @brief Release strings taken from pool.
+     * @param strings Strings to release.
+     */
+    void release(const QStringList& strings);
+
+    /**
+     * @brief Get number of distinct strings in pool.
+     * @return Number of strings.
+     */
+    int size() const;
+
+    /**
+     * @brief Get number of bytes used by strings in pool.
+     * @return Number of bytes.
+     */
+    quint64 getMemoryUsage() const;
+
+    /**
+     * @brief Get part of pool memory used by given strings. Memory of each
+     * string is divided equally between its users, so shares of all users
+     * sum up to getMemoryUsage().
+     * @param strings Strings taken from pool.
+     * @return Number of bytes.
+     */
+    quint64 getMemoryShare(const QStringList& strings) const;
+
+private:
+    static quint64 getStringMemoryUsage(const QString& string);
+
+    StringInterner() = default;
+    ~StringInterner() = default;
+
+    QString internUnlocked(const QString& string);
+
+    /// Pooled strings with number of their users.
+    QHash<QString, int> references_;
+
+    mutable QMutex mutex_;
+};
@@ -0,0 +1,58 @@
+#include "StringsTable.h"
+
+#include <cstring>
+
+void StringsTable::appendLines(const QByteArray& content)
+{
+    // Content is shared without copying when table has no bytes yet.
+    const qsizetype base{utf8_.size()};
+    if (utf8_.isEmpty())
+        utf8_ = content;
+    else
+        utf8_.append(content);
+
+    const char* data{content.constData()};
+    qsizetype begin{0};
+    while (begin <= content.size())
+    {
+        const auto* newLine{static_cast<const char*>(
+            std::memchr(data + begin, '\n', content.size() - begin))};
+        const qsizetype end{newLine != nullptr ? newLine - data
+                                               : content.size()};
+        entries_.append({base + begin, end - begin});
+        begin = end + 1;
+    }
+}
+
+void StringsTable::append(QByteArrayView utf8)
+{
+    entries_.append({utf8_.size(), utf8.size()});
+    utf8_.append(utf8);
+}
+
+qsizetype StringsTable::size() const { return entries_.size(); }
+
+bool StringsTable::isEmpty() const { return entries_.isEmpty(); }
+
+QByteArrayView StringsTable::getUtf8(qsizetype index) const
+{
+    const Entry& entry{entries_[index]};
+    return {utf8_.constData() + entry.offset_, entry.size_};
+}
+
+QString StringsTable::getString(qsizetype index) const
+{
+    return QString::fromUtf8(getUtf8(index));
+}
+
+void StringsTable::clear()
+{
+    utf8_ = QByteArray();
+    entries_ = QVector<Entry>();
+}
+
+quint64 StringsTable::getMemoryUsage() const
+{
+    return static_cast<quint64>(utf8_.capacity()) +
+           static_cast<quint64>(entries_.capacity()) * sizeof(Entry);
+}
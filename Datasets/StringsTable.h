@@ -0,0 +1,68 @@
+#pragma once
+
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QString>
+#include <QVector>
+
+/**
+ * @class StringsTable
+ * @brief Strings table of source kept as UTF-8 bytes with index of offsets.
+ * Strings are decoded only when requested, so sources with millions of
+ * unique strings can be previewed cheaply.
+ */
+class StringsTable
+{
+public:
+    /**
+     * @brief Append each line of content as separate string.
+     * @param content UTF-8 strings separated by new line characters.
+     */
+    void appendLines(const QByteArray& content);
+
+    /**
+     * @brief Append single string.
+     * @param utf8 UTF-8 bytes of string.
+     */
+    void append(QByteArrayView utf8);
+
+    qsizetype size() const;
+
+    bool isEmpty() const;
+
+    /**
+     * @brief Get bytes of string without decoding it.
+     * @param index Index of string.
+     * @return View on UTF-8 bytes valid until table is changed.
+     */
+    QByteArrayView getUtf8(qsizetype index) const;
+
+    /**
+     * @brief Decode string.
+     * @param index Index of string.
+     * @return Decoded string.
+     */
+    QString getString(qsizetype index) const;
+
+    /**
+     * @brief Release content and index.
+     */
+    void clear();
+
+    /**
+     * @brief Get number of bytes used by content and index.
+     * @return Number of bytes.
+     */
+    quint64 getMemoryUsage() const;
+
+private:
+    struct Entry
+    {
+        qsizetype offset_;
+        qsizetype size_;
+    };
+
+    QByteArray utf8_;
+
+    QVector<Entry> entries_;
+};
@@ -1,27 +1,123 @@
 #include "ExportVbx.h"
 
+#include <algorithm>
+
 #include <FilteringProxyModel.h>
 #include <quazip/quazipfile.h>
 #include <QAbstractItemView>
 #include <QFile>
+#include <QtEndian>
 #include <QVariant>
 
 #include <Common/DatasetUtilities.h>
+#include <Datasets/DatasetSnapshot.h>
 #include <ModelsAndViews/TableModel.h>
 #include <Shared/Logger.h>
 
-ExportVbx::ExportVbx(QObject* parent) : ExportData(parent) {}
+namespace
+{
+template <typename T>
+void appendLittleEndian(QByteArray& destination, T value)
+{
+    const qsizetype position{destination.size()};
+    destination.resize(position + static_cast<qsizetype>(sizeof(T)));
+    qToLittleEndian<T>(value, destination.data() + position);
+}
+}  // namespace
+
+ExportVbx::ExportVbx(DatasetFormat format, QObject* parent)
+    : ExportData(parent), format_(format)
+{
+}
+
+void ExportVbx::setBlockRowCount(unsigned int blockRows)
+{
+    blockRows_ = blockRows;
+}
 
 bool ExportVbx::generateVbx(const QAbstractItemView& view, QIODevice& ioDevice)
 {
-    return exportView(view, ioDevice) && exportStrings(ioDevice) &&
-           exportDefinition(view, ioDevice);
+    if (!openArchive(ioDevice))
+        return false;
+
+    bool success{false};
+    if (format_ == DatasetFormat::COLUMNAR)
+    {
+        prepareColumnBlocks(view);
+        success = exportView(view, ioDevice) && exportDefinition(view);
+    }
+    else
+    {
+        success = exportView(view, ioDevice) && exportStrings() &&
+                  exportDefinition(view);
+    }
+    return closeArchive(success);
+}
+
+bool ExportVbx::generateVbx(const DatasetSnapshot& snapshot,
+                            const QByteArray& definition, QIODevice& ioDevice)
+{
+    Q_ASSERT(format_ == DatasetFormat::COLUMNAR);
+    if (!openArchive(ioDevice))
+        return false;
+
+    QVector<ColumnType> columnTypes;
+    for (int column = 0; column < snapshot.columnCount(); ++column)
+        columnTypes.append(snapshot.getColumn(column).getColumnType());
+    const auto rowCount{static_cast<unsigned int>(snapshot.rowCount())};
+    prepareColumnBlocks(columnTypes, rowCount);
+
+    // Columns are filled block by block from typed storage, without model.
+    bool success{true};
+    for (unsigned int firstRow = 0; success && firstRow < rowCount;
+         firstRow += blockRows_)
+    {
+        const unsigned int rows{std::min(blockRows_, rowCount - firstRow)};
+        for (int column = 0; column < snapshot.columnCount(); ++column)
+            appendColumnRows(snapshot.getColumn(column),
+                             columnBlocks_[column], firstRow, rows);
+        lines_ += rows;
+        success = writeFilledBlocks();
+    }
+
+    success = success && writeZonesAndDictionaries() &&
+              write(DatasetUtilities::getDatasetDefinitionFilename(),
+                    definition);
+    return closeArchive(success);
+}
+
+bool ExportVbx::openArchive(QIODevice& ioDevice)
+{
+    // Archive stays open for whole export instead of reopening it to append
+    // each entry.
+    zip_ = std::make_unique<QuaZip>(&ioDevice);
+    if (!zip_->open(QuaZip::mdCreate))
+    {
+        LOG(LogTypes::IMPORT_EXPORT, QStringLiteral("Can not create archive."));
+        zip_.reset();
+        return false;
+    }
+
+    writeFailed_ = false;
+    lines_ = 0;
+    return true;
+}
+
+bool ExportVbx::closeArchive(bool success)
+{
+    zip_->close();
+    success = success && zip_->getZipError() == UNZ_OK;
+    zip_.reset();
+    return success;
 }
 
-bool ExportVbx::writeContent(const QByteArray& content, QIODevice& ioDevice)
+bool ExportVbx::writeContent(const QByteArray& content,
+                             [[maybe_unused]] QIODevice& ioDevice)
 {
-    return write(ioDevice, DatasetUtilities::getDatasetDataFilename(), content,
-                 QuaZip::mdCreate);
+    if (format_ == DatasetFormat::COLUMNAR)
+        return !writeFailed_ && writeColumnBlocks();
+
+    return write(DatasetUtilities::getDatasetDataFilename(), content);
 }
 
 QByteArray ExportVbx::getEmptyContent() { return QByteArrayLiteral(""); }
@@ -36,6 +132,17 @@ QByteArray ExportVbx::generateRowContent(const QAbstractItemModel& model,
                                          int row,
                                          [[maybe_unused]] int skippedRowsCount)
 {
+    if (format_ == DatasetFormat::COLUMNAR)
+    {
+        appendToColumnBlocks(model, row);
+        lines_++;
+
+        // Filled blocks are written at once, so only one is kept in memory.
+        if (lines_ % blockRows_ == 0 && !writeFailed_)
+            writeFailed_ = !writeFilledBlocks();
+        return {};
+    }
+
     QByteArray rowContent;
     for (int j = 0; j < model.columnCount(); ++j)
     {
@@ -54,21 +161,297 @@ QByteArray ExportVbx::generateRowContent(const QAbstractItemModel& model,
 
 QByteArray ExportVbx::getContentEnding() { return QByteArrayLiteral(""); }
 
-bool ExportVbx::exportStrings(QIODevice& ioDevice)
+bool ExportVbx::exportStrings()
+{
+    return write(DatasetUtilities::getDatasetStringsFilename(),
+                 stringsContent_);
+}
+
+bool ExportVbx::exportDefinition(const QAbstractItemView& view)
 {
-    return write(ioDevice, DatasetUtilities::getDatasetStringsFilename(),
-                 stringsContent_, QuaZip::mdAdd);
+    const TableModel* parentModel =
+        (qobject_cast<FilteringProxyModel*>(view.model()))->getParentModel();
+    const QByteArray definitionContent{
+        parentModel->definitionToXml(lines_, format_, blockRows_)};
+
+    return write(DatasetUtilities::getDatasetDefinitionFilename(),
+                 definitionContent);
 }
 
-bool ExportVbx::exportDefinition(const QAbstractItemView& view,
-                                 QIODevice& ioDevice) const
+void ExportVbx::prepareColumnBlocks(const QAbstractItemView& view)
 {
     const TableModel* parentModel =
         (qobject_cast<FilteringProxyModel*>(view.model()))->getParentModel();
-    const QByteArray definitionContent{parentModel->definitionToXml(lines_)};
+    QVector<ColumnType> columnTypes;
+    for (int column = 0; column < view.model()->columnCount(); ++column)
+        columnTypes.append(parentModel->getColumnFormat(column));
+    prepareColumnBlocks(columnTypes, view.model()->rowCount());
+}
 
-    return write(ioDevice, DatasetUtilities::getDatasetDefinitionFilename(),
-                 definitionContent, QuaZip::mdAdd);
+void ExportVbx::prepareColumnBlocks(const QVector<ColumnType>& columnTypes,
+                                    qsizetype rowCount)
+{
+    const qsizetype blockRows{
+        std::min(rowCount, static_cast<qsizetype>(blockRows_))};
+    const qsizetype bitsInByte{8};
+    columnBlocks_.clear();
+    for (const ColumnType columnType : columnTypes)
+    {
+        ColumnBlock block;
+        block.columnType_ = columnType;
+        const auto valueSize{static_cast<qsizetype>(
+            columnType == ColumnType::NUMBER ? sizeof(double)
+                                             : sizeof(qint32))};
+        block.validity_.reserve((blockRows + bitsInByte - 1) / bitsInByte);
+        block.values_.reserve(blockRows * valueSize);
+        columnBlocks_.append(block);
+    }
+}
+
+void ExportVbx::appendToColumnBlocks(const QAbstractItemModel& model, int row)
+{
+    const unsigned int rowInBlock{lines_ % blockRows_};
+    for (int column = 0; column < columnBlocks_.size(); ++column)
+    {
+        ColumnBlock& block{columnBlocks_[column]};
+        const QVariant field{model.index(row, column).data()};
+        const bool valid{!field.isNull()};
+        switch (block.columnType_)
+        {
+            case ColumnType::NUMBER:
+                appendNumber(block, rowInBlock, valid,
+                             valid ? field.toDouble() : 0.);
+                break;
+
+            case ColumnType::DATE:
+                appendJulianDay(
+                    block, rowInBlock, valid,
+                    valid ? static_cast<qint32>(field.toDate().toJulianDay())
+                          : 0);
+                break;
+
+            case ColumnType::STRING:
+                appendString(block, rowInBlock, valid,
+                             valid ? field.toString() : QString());
+                break;
+
+            case ColumnType::UNKNOWN:
+                Q_ASSERT(false);
+                break;
+        }
+    }
+}
+
+ExportVbx::Zone& ExportVbx::appendValidity(ColumnBlock& block,
+                                           unsigned int rowInBlock, bool valid)
+{
+    // Each block starts own validity bitmap, so it can be read separately.
+    const unsigned int bitsInByte{8};
+    const auto bit{static_cast<int>(rowInBlock % bitsInByte)};
+    if (rowInBlock == 0)
+        block.zones_.append(Zone());
+    Zone& zone{block.zones_.back()};
+    if (bit == 0)
+        block.validity_.append('\0');
+    if (valid)
+    {
+        block.validity_.back() =
+            static_cast<char>(block.validity_.back() | (1 << bit));
+        ++zone.validRows_;
+    }
+    return zone;
+}
+
+void ExportVbx::appendNumber(ColumnBlock& block, unsigned int rowInBlock,
+                             bool valid, double value)
+{
+    Zone& zone{appendValidity(block, rowInBlock, valid)};
+    appendLittleEndian<double>(block.values_, value);
+    if (valid)
+        updateRange(zone, value);
+}
+
+void ExportVbx::appendJulianDay(ColumnBlock& block, unsigned int rowInBlock,
+                                bool valid, qint32 julianDay)
+{
+    Zone& zone{appendValidity(block, rowInBlock, valid)};
+    appendLittleEndian<qint32>(block.values_, julianDay);
+    if (valid)
+        updateRange(zone, julianDay);
+}
+
+void ExportVbx::appendString(ColumnBlock& block, unsigned int rowInBlock,
+                             bool valid, const QString& string)
+{
+    Zone& zone{appendValidity(block, rowInBlock, valid)};
+    if (!valid)
+    {
+        appendLittleEndian<quint32>(block.values_, 0);
+        return;
+    }
+
+    auto it{block.codes_.constFind(string)};
+    if (it == block.codes_.constEnd())
+    {
+        const QByteArray utf8{string.toUtf8()};
+        appendLittleEndian<quint32>(block.dictionary_,
+                                    static_cast<quint32>(utf8.size()));
+        block.dictionary_.append(utf8);
+        it = block.codes_.insert(string,
+                                 static_cast<quint32>(block.codes_.size()));
+    }
+    appendLittleEndian<quint32>(block.values_, it.value());
+    if (zone.anyCode_)
+        return;
+    const auto position{std::lower_bound(zone.codes_.cbegin(),
+                                         zone.codes_.cend(), it.value())};
+    if (position != zone.codes_.cend() && *position == it.value())
+        return;
+    if (zone.codes_.size() == static_cast<qsizetype>(COLUMNAR_ZONE_MAX_CODES))
+    {
+        zone.anyCode_ = true;
+        zone.codes_ = {};
+        return;
+    }
+    zone.codes_.insert(position - zone.codes_.cbegin(), it.value());
+}
+
+void ExportVbx::appendColumnRows(const DataColumn& dataColumn,
+                                 ColumnBlock& block, unsigned int firstRow,
+                                 unsigned int rows)
+{
+    for (unsigned int rowInBlock = 0; rowInBlock < rows; ++rowInBlock)
+    {
+        const auto row{static_cast<int>(firstRow + rowInBlock)};
+        const bool valid{!dataColumn.isNull(row)};
+        switch (block.columnType_)
+        {
+            case ColumnType::NUMBER:
+                appendNumber(block, rowInBlock, valid,
+                             valid ? dataColumn.getNumber(row) : 0.);
+                break;
+
+            case ColumnType::DATE:
+                appendJulianDay(block, rowInBlock, valid,
+                                valid ? dataColumn.getJulianDay(row) : 0);
+                break;
+
+            case ColumnType::STRING:
+                if (valid)
+                    appendString(block, rowInBlock, valid,
+                                 dataColumn.getString(row));
+                else
+                    appendString(block, rowInBlock, valid, {});
+                break;
+
+            case ColumnType::UNKNOWN:
+                Q_ASSERT(false);
+                break;
+        }
+    }
+}
+
+bool ExportVbx::writeFilledBlocks()
+{
+    for (int column = 0; column < columnBlocks_.size(); ++column)
+    {
+        ColumnBlock& block{columnBlocks_[column]};
+        QByteArray content{block.validity_};
+        content.append(block.values_);
+        if (!write(DatasetUtilities::getDatasetColumnFilename(
+                       column, static_cast<int>(block.zones_.size()) - 1),
+                   content))
+            return false;
+
+        // Capacity is kept for next block.
+        block.validity_.clear();
+        block.values_.clear();
+    }
+    return true;
+}
+
+bool ExportVbx::writeColumnBlocks()
+{
+    // Last block is not full when row count is not multiple of block size.
+    if (lines_ % blockRows_ != 0 && !writeFilledBlocks())
+        return false;
+    return writeZonesAndDictionaries();
+}
+
+bool ExportVbx::writeZonesAndDictionaries()
+{
+    for (int column = 0; column < columnBlocks_.size(); ++column)
+    {
+        const ColumnBlock& block{columnBlocks_[column]};
+        if (!write(DatasetUtilities::getDatasetZonesFilename(column),
+                   zonesToBytes(block)))
+            return false;
+
+        if (block.columnType_ != ColumnType::STRING)
+            continue;
+
+        QByteArray dictionary;
+        appendLittleEndian<quint32>(dictionary,
+                                    static_cast<quint32>(block.codes_.size()));
+        dictionary.append(block.dictionary_);
+        if (!write(DatasetUtilities::getDatasetDictionaryFilename(column),
+                   dictionary))
+            return false;
+    }
+    return true;
+}
+
+void ExportVbx::updateRange(Zone& zone, double value)
+{
+    // First value of block sets both ends of range.
+    if (zone.validRows_ == 1 || value < zone.min_)
+        zone.min_ = value;
+    if (zone.validRows_ == 1 || value > zone.max_)
+        zone.max_ = value;
+}
+
+QByteArray ExportVbx::zonesToBytes(const ColumnBlock& block)
+{
+    // Each zone has count of rows with values followed by minimum and
+    // maximum for numbers and dates or count and list of present codes for
+    // strings.
+    QByteArray content;
+    for (const Zone& zone : block.zones_)
+    {
+        appendLittleEndian<quint32>(content, zone.validRows_);
+        switch (block.columnType_)
+        {
+            case ColumnType::NUMBER:
+                appendLittleEndian<double>(content, zone.min_);
+                appendLittleEndian<double>(content, zone.max_);
+                break;
+
+            case ColumnType::DATE:
+                appendLittleEndian<qint32>(content,
+                                           static_cast<qint32>(zone.min_));
+                appendLittleEndian<qint32>(content,
+                                           static_cast<qint32>(zone.max_));
+                break;
+
+            case ColumnType::STRING:
+                if (zone.anyCode_)
+                {
+                    appendLittleEndian<quint32>(content,
+                                                COLUMNAR_ZONE_ANY_CODE);
+                    break;
+                }
+                appendLittleEndian<quint32>(
+                    content, static_cast<quint32>(zone.codes_.size()));
+                for (const quint32 code : zone.codes_)
+                    appendLittleEndian<quint32>(content, code);
+                break;
+
+            case ColumnType::UNKNOWN:
+                Q_ASSERT(false);
+                break;
+        }
+    }
+    return content;
 }
 
 void ExportVbx::variantToString(const QVariant& variant,
@@ -118,15 +501,9 @@ void ExportVbx::variantToString(const QVariant& variant,
     }
 }
 
-bool ExportVbx::write(QIODevice& ioDevice, const QString& fileName,
-                      const QByteArray& data, QuaZip::Mode mode)
+bool ExportVbx::write(const QString& fileName, const QByteArray& data)
 {
-    QuaZip outZip(&ioDevice);
-    const bool openSuccess = outZip.open(mode);
-    if (!openSuccess)
-        return false;
-
-    QuaZipFile zipFile(&outZip);
+    QuaZipFile zipFile(zip_.get());
     const bool result =
         zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(fileName));
     if (!result || zipFile.write(data) == -1)
@@ -136,5 +513,6 @@ bool ExportVbx::write(QIODevice& ioDevice, const QString& fileName,
         return false;
     }
 
-    return true;
+    zipFile.close();
+    return zipFile.getZipError() == UNZ_OK;
 }
@@ -1,12 +1,18 @@
 #pragma once
 
+#include <memory>
+
 #include <QVector>
 
+#include <ColumnType.h>
+#include <DatasetFormat.h>
 #include <ExportData.h>
 #include <QHash>
 
 #include <quazip/quazip.h>
 
+class DataColumn;
+class DatasetSnapshot;
 class QAbstractItemModel;
 class QAbstractItemView;
 class QIODevice;
@@ -20,7 +26,13 @@ class ExportVbx : public ExportData
 {
     Q_OBJECT
 public:
-    explicit ExportVbx(QObject* parent = nullptr);
+    /**
+     * @brief ExportVbx constructor.
+     * @param format Layout of generated file.
+     * @param parent Parent object.
+     */
+    explicit ExportVbx(DatasetFormat format = DatasetFormat::COLUMNAR,
+                       QObject* parent = nullptr);
 
     /**
      * @brief Generate inner Volbx format of data (.vbx).
@@ -30,6 +42,25 @@ public:
      */
     bool generateVbx(const QAbstractItemView& view, QIODevice& ioDevice);
 
+    /**
+     * @brief Generate .vbx file in COLUMNAR format straight from columns of
+     * loaded dataset. Can be called on worker thread.
+     * @param snapshot Columns of loaded dataset.
+     * @param definition Definition created by Dataset::definitionToXml() for
+     * COLUMNAR format and block row count of this exporter.
+     * @param ioDevice Device to write to.
+     * @return True on success, false otherwise.
+     */
+    bool generateVbx(const DatasetSnapshot& snapshot,
+                     const QByteArray& definition, QIODevice& ioDevice);
+
+    /**
+     * @brief Set number of rows in blocks of columns for COLUMNAR format.
+     * Smaller blocks allow skipping more data when filtered while loading.
+     * @param blockRows Number of rows.
+     */
+    void setBlockRowCount(unsigned int blockRows);
+
 protected:
     bool writeContent(const QByteArray& content, QIODevice& ioDevice) override;
 
@@ -46,13 +77,86 @@ private:
     void variantToString(const QVariant& variant, QByteArray& destinationArray,
                          char separator);
 
-    bool exportStrings(QIODevice& ioDevice);
+    bool exportStrings();
+
+    bool exportDefinition(const QAbstractItemView& view);
+
+    bool openArchive(QIODevice& ioDevice);
+
+    bool closeArchive(bool success);
+
+    void prepareColumnBlocks(const QAbstractItemView& view);
+
+    void prepareColumnBlocks(const QVector<ColumnType>& columnTypes,
+                             qsizetype rowCount);
+
+    void appendToColumnBlocks(const QAbstractItemModel& model, int row);
+
+    bool writeFilledBlocks();
+
+    bool writeColumnBlocks();
+
+    bool writeZonesAndDictionaries();
+
+    bool write(const QString& fileName, const QByteArray& data);
+
+    /// Summary of block of rows used to skip it when filtered on load.
+    struct Zone
+    {
+        quint32 validRows_{0};
+
+        /// Range of numbers or Julian days.
+        double min_{0.};
+        double max_{0.};
+
+        /// Sorted codes of strings present in block, empty when there are
+        /// more than COLUMNAR_ZONE_MAX_CODES of them.
+        QVector<quint32> codes_;
+
+        bool anyCode_{false};
+    };
+
+    /// Validity bitmap and values of block being filled, zone maps and
+    /// dictionary of column for COLUMNAR format.
+    struct ColumnBlock
+    {
+        ColumnType columnType_{ColumnType::UNKNOWN};
+        QByteArray validity_;
+        QByteArray values_;
+        QVector<Zone> zones_;
+        QHash<QString, quint32> codes_;
+        QByteArray dictionary_;
+    };
+
+    static Zone& appendValidity(ColumnBlock& block, unsigned int rowInBlock,
+                                bool valid);
+
+    static void appendNumber(ColumnBlock& block, unsigned int rowInBlock,
+                             bool valid, double value);
+
+    static void appendJulianDay(ColumnBlock& block, unsigned int rowInBlock,
+                                bool valid, qint32 julianDay);
+
+    static void appendString(ColumnBlock& block, unsigned int rowInBlock,
+                             bool valid, const QString& string);
+
+    static void appendColumnRows(const DataColumn& dataColumn,
+                                 ColumnBlock& block, unsigned int firstRow,
+                                 unsigned int rows);
+
+    static void updateRange(Zone& zone, double value);
+
+    static QByteArray zonesToBytes(const ColumnBlock& block);
+
+    const DatasetFormat format_;
+    unsigned int blockRows_{COLUMNAR_BLOCK_ROWS};
+    QVector<ColumnBlock> columnBlocks_;
 
-    bool exportDefinition(const QAbstractItemView& view,
-                          QIODevice& ioDevice) const;
+    /// Archive written during whole export, entries are added one by one.
+    std::unique_ptr<QuaZip> zip_;
 
-    static bool write(QIODevice& ioDevice, const QString& fileName,
-                      const QByteArray& data, QuaZip::Mode mode);
+    /// Set when writing of filled block failed while rows were exported.
+    bool writeFailed_{false};
 
     static constexpr char separator_{';'};
     QHash<QString, int> stringsMap_;
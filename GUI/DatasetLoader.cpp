@@ -0,0 +1,102 @@
+#include "DatasetLoader.h"
+
+#include <new>
+
+#include <ProgressBarCounter.h>
+#include <QHBoxLayout>
+#include <QThread>
+
+#include <Common/Constants.h>
+#include <Datasets/Dataset.h>
+#include <Shared/Logger.h>
+
+DatasetLoader::DatasetLoader(std::unique_ptr<Dataset> dataset,
+                             QObject* parent)
+    : QObject(parent),
+      dataset_(std::move(dataset)),
+      datasetName_(dataset_->getName()),
+      bar_(new ProgressBarCounter(
+          Constants::getProgressBarTitle(Constants::BarTitle::LOADING),
+          Constants::getProgressBarFullCounter(), &window_)),
+      cancelButton_(tr("Cancel"))
+{
+    window_.setWindowFlags(Qt::Tool | Qt::WindowTitleHint |
+                           Qt::CustomizeWindowHint);
+    window_.setWindowTitle(datasetName_);
+    auto* layout{new QHBoxLayout(&window_)};
+    layout->addWidget(bar_);
+    layout->addWidget(&cancelButton_);
+
+    // Dataset emits progress from worker thread, queued connection is used.
+    connect(dataset_.get(), &Dataset::loadingPercentChanged, bar_,
+            &ProgressBarCounter::updateProgress, Qt::QueuedConnection);
+    connect(&cancelButton_, &QPushButton::clicked, this,
+            &DatasetLoader::cancel);
+}
+
+DatasetLoader::~DatasetLoader()
+{
+    if (thread_ == nullptr || thread_->isFinished())
+        return;
+
+    dataset_->cancelLoading();
+    thread_->wait();
+}
+
+void DatasetLoader::start()
+{
+    performanceTimer_.start();
+    thread_.reset(QThread::create(
+        [this]()
+        {
+            try
+            {
+                dataset_->loadData();
+            }
+            catch (std::bad_alloc&)
+            {
+                outOfMemory_ = true;
+            }
+        }));
+    connect(thread_.get(), &QThread::finished, this,
+            &DatasetLoader::loadingFinished);
+    window_.show();
+    thread_->start();
+}
+
+std::unique_ptr<Dataset> DatasetLoader::takeDataset()
+{
+    return std::move(dataset_);
+}
+
+QString DatasetLoader::getDatasetName() const { return datasetName_; }
+
+bool DatasetLoader::wasCancelled() const { return cancelled_; }
+
+bool DatasetLoader::wasOutOfMemory() const { return outOfMemory_; }
+
+void DatasetLoader::cancel()
+{
+    cancelButton_.setEnabled(false);
+    cancelled_ = true;
+    dataset_->cancelLoading();
+}
+
+void DatasetLoader::loadingFinished()
+{
+    window_.hide();
+    if (cancelled_ || outOfMemory_)
+    {
+        // Release partially loaded data at once.
+        dataset_ = nullptr;
+    }
+    else
+    {
+        LOG(LogTypes::IMPORT_EXPORT,
+            "Loaded file having " + QString::number(dataset_->rowCount()) +
+                " rows in time " +
+                Constants::timeFromTimeToSeconds(performanceTimer_) +
+                " seconds.");
+    }
+    Q_EMIT finished();
+}
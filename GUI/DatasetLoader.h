@@ -0,0 +1,80 @@
+#pragma once
+
+#include <memory>
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QPushButton>
+#include <QWidget>
+
+class Dataset;
+class ProgressBarCounter;
+class QThread;
+
+/**
+ * @brief Loads data of dataset on worker thread, so GUI stays responsive.
+ * Shows progress bar with button allowing to cancel loading.
+ */
+class DatasetLoader : public QObject
+{
+    Q_OBJECT
+public:
+    explicit DatasetLoader(std::unique_ptr<Dataset> dataset,
+                           QObject* parent = nullptr);
+
+    ~DatasetLoader() override;
+
+    DatasetLoader& operator=(const DatasetLoader& other) = delete;
+    DatasetLoader(const DatasetLoader& other) = delete;
+
+    DatasetLoader& operator=(DatasetLoader&& other) = delete;
+    DatasetLoader(DatasetLoader&& other) = delete;
+
+    /**
+     * @brief Start loading on worker thread.
+     */
+    void start();
+
+    /**
+     * @brief Take loaded dataset, call after finished() was emitted.
+     * @return Dataset or nullptr when loading was cancelled or failed due to
+     * lack of memory.
+     */
+    std::unique_ptr<Dataset> takeDataset();
+
+    QString getDatasetName() const;
+
+    bool wasCancelled() const;
+
+    bool wasOutOfMemory() const;
+
+Q_SIGNALS:
+    /**
+     * @brief Emitted on GUI thread when worker thread ended.
+     */
+    void finished();
+
+private:
+    void cancel();
+
+    void loadingFinished();
+
+    std::unique_ptr<Dataset> dataset_;
+
+    const QString datasetName_;
+
+    /// Window with progress bar and cancel button.
+    QWidget window_;
+
+    ProgressBarCounter* bar_;
+
+    QPushButton cancelButton_;
+
+    std::unique_ptr<QThread> thread_;
+
+    QElapsedTimer performanceTimer_;
+
+    bool cancelled_{false};
+
+    bool outOfMemory_{false};
+};
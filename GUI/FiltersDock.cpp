@@ -115,17 +115,16 @@ FilterStrings* FiltersDock::createStringsFilter(const TableModel* parentModel,
                                                 int index)
 {
     const QString columnName{getColumnName(parentModel, index)};
-    QStringList list{parentModel->getStringList(index)};
-    const qsizetype itemCount{list.size()};
-    list.sort();
-    auto* filter{new FilterStrings(columnName, std::move(list))};
+    const ColumnStatistics& statistics{
+        parentModel->getColumnStatistics(index)};
+    auto* filter{new FilterStrings(columnName, statistics.sortedStrings_)};
     auto emitChangeForColumn{[=](QStringList bannedList) {
         Q_EMIT filterNames(index, std::move(bannedList));
     }};
     connect(filter, &FilterStrings::newStringFilter, this, emitChangeForColumn);
 
     filter->setCheckable(true);
-    if (itemCount <= 1)
+    if (statistics.distinctCount_ <= 1)
         filter->setChecked(false);
 
     return filter;
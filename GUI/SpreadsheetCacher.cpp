@@ -0,0 +1,88 @@
+#include "SpreadsheetCacher.h"
+
+#include <new>
+#include <utility>
+
+#include <QFile>
+#include <QThread>
+
+#include <Common/Configuration.h>
+#include <Common/Constants.h>
+#include <Common/DatasetFormat.h>
+#include <Common/DatasetUtilities.h>
+#include <Datasets/Dataset.h>
+#include <Datasets/SpreadsheetCache.h>
+#include <Export/ExportVbx.h>
+#include <Shared/Logger.h>
+
+namespace
+{
+SpreadsheetCache openCache()
+{
+    return {DatasetUtilities::getSpreadsheetsCacheDir(),
+            Constants::megabytesToBytes(
+                Configuration::getInstance().getSpreadsheetCacheSize())};
+}
+}  // namespace
+
+SpreadsheetCacher::SpreadsheetCacher(const Dataset& dataset, QString cacheKey,
+                                     QObject* parent)
+    : QObject(parent),
+      snapshot_(dataset.getSnapshot()),
+      definition_(
+          dataset.definitionToXml(dataset.rowCount(), DatasetFormat::COLUMNAR)),
+      cacheKey_(std::move(cacheKey)),
+      partialFilePath_(openCache().getPartialFilePath(cacheKey_))
+{
+}
+
+SpreadsheetCacher::~SpreadsheetCacher()
+{
+    if (thread_ != nullptr)
+        thread_->wait();
+}
+
+void SpreadsheetCacher::start()
+{
+    performanceTimer_.start();
+    thread_.reset(QThread::create(
+        [this]()
+        {
+            QFile file(partialFilePath_);
+            ExportVbx exportVbx;
+            try
+            {
+                written_ = snapshot_ != nullptr &&
+                           exportVbx.generateVbx(*snapshot_, definition_, file);
+            }
+            catch (std::bad_alloc&)
+            {
+                written_ = false;
+            }
+        }));
+    connect(thread_.get(), &QThread::finished, this,
+            &SpreadsheetCacher::writingFinished);
+    thread_->start();
+}
+
+void SpreadsheetCacher::writingFinished()
+{
+    // Snapshot is released at once, dataset may be already closed.
+    snapshot_ = nullptr;
+
+    // Index of cache is read again as other files could be cached meanwhile.
+    SpreadsheetCache cache{openCache()};
+    if (!written_ || !cache.insert(cacheKey_, partialFilePath_))
+    {
+        QFile::remove(partialFilePath_);
+        LOG(LogTypes::IMPORT_EXPORT, QStringLiteral("Caching failed."));
+    }
+    else
+    {
+        LOG(LogTypes::IMPORT_EXPORT,
+            "Spreadsheet cached in " +
+                Constants::timeFromTimeToSeconds(performanceTimer_) +
+                " seconds.");
+    }
+    Q_EMIT finished();
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <memory>
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QObject>
+
+class Dataset;
+class DatasetSnapshot;
+class QThread;
+
+/**
+ * @brief Stores loaded spreadsheet as columnar .vbx file in cache of
+ * converted spreadsheets. File is written on worker thread from snapshot of
+ * dataset, so GUI stays responsive and dataset can be closed meanwhile.
+ */
+class SpreadsheetCacher : public QObject
+{
+    Q_OBJECT
+public:
+    SpreadsheetCacher(const Dataset& dataset, QString cacheKey,
+                      QObject* parent = nullptr);
+
+    ~SpreadsheetCacher() override;
+
+    SpreadsheetCacher& operator=(const SpreadsheetCacher& other) = delete;
+    SpreadsheetCacher(const SpreadsheetCacher& other) = delete;
+
+    SpreadsheetCacher& operator=(SpreadsheetCacher&& other) = delete;
+    SpreadsheetCacher(SpreadsheetCacher&& other) = delete;
+
+    /**
+     * @brief Start writing file on worker thread.
+     */
+    void start();
+
+Q_SIGNALS:
+    /**
+     * @brief Emitted on GUI thread when file was written and inserted into
+     * cache or when caching failed.
+     */
+    void finished();
+
+private:
+    void writingFinished();
+
+    std::shared_ptr<const DatasetSnapshot> snapshot_;
+
+    /// Definition of dataset, created on GUI thread.
+    const QByteArray definition_;
+
+    const QString cacheKey_;
+
+    QString partialFilePath_;
+
+    std::unique_ptr<QThread> thread_;
+
+    QElapsedTimer performanceTimer_;
+
+    bool written_{false};
+};
@@ -33,6 +33,14 @@ TableModel* Tab::getCurrentTableModel() const
 
 DataView* Tab::getCurrentDataView() const { return findChild<DataView*>(); }
 
+MemoryUsage Tab::getMemoryUsage() const
+{
+    MemoryUsage memoryUsage{getCurrentTableModel()->getMemoryUsage()};
+    memoryUsage.proxyMappings_ =
+        getCurrentProxyModel()->getMappingMemoryUsage();
+    return memoryUsage;
+}
+
 DataViewDock* Tab::createDataViewDock(FilteringProxyModel* proxyModel)
 {
     auto* dock{new DataViewDock(tr("Data"), this)};
@@ -4,6 +4,8 @@
 
 #include <QMainWindow>
 
+#include <Datasets/MemoryUsage.h>
+
 class Dataset;
 class TableModel;
 class DataView;
@@ -25,6 +27,12 @@ public:
 
     DataView* getCurrentDataView() const;
 
+    /**
+     * @brief Get memory used by dataset and proxy model of tab.
+     * @return Memory usage.
+     */
+    MemoryUsage getMemoryUsage() const;
+
 private:
     DataViewDock* createDataViewDock(FilteringProxyModel* proxyModel);
 };
@@ -37,6 +37,20 @@ DataView* TabWidget::getCurrentDataView() const
     return getCurrentMainTab()->getCurrentDataView();
 }
 
+MemoryUsage TabWidget::getCurrentMemoryUsage() const
+{
+    return getCurrentMainTab()->getMemoryUsage();
+}
+
+MemoryUsage TabWidget::getTotalMemoryUsage() const
+{
+    MemoryUsage memoryUsage;
+    for (int i = 0; i < count(); ++i)
+        if (const auto* tab{dynamic_cast<Tab*>(widget(i))}; tab != nullptr)
+            memoryUsage += tab->getMemoryUsage();
+    return memoryUsage;
+}
+
 Tab* TabWidget::getCurrentMainTab() const
 {
     auto* currentTab{dynamic_cast<Tab*>(currentWidget())};
@@ -5,6 +5,8 @@
 #include <QDate>
 #include <QTabWidget>
 
+#include <Datasets/MemoryUsage.h>
+
 class TableModel;
 class DataView;
 class FilteringProxyModel;
@@ -27,6 +29,18 @@ public:
 
     DataView* getCurrentDataView() const;
 
+    /**
+     * @brief Get memory used by current tab.
+     * @return Memory usage.
+     */
+    MemoryUsage getCurrentMemoryUsage() const;
+
+    /**
+     * @brief Get memory used by all tabs.
+     * @return Memory usage.
+     */
+    MemoryUsage getTotalMemoryUsage() const;
+
 public Q_SLOTS:
     void setTextFilter(int column, const QStringList& bannedStrings);
 
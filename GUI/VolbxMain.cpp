@@ -1,9 +1,13 @@
 #include "VolbxMain.h"
 
+#include <algorithm>
+#include <limits>
+
 #include <ProgressBarCounter.h>
 #include <QActionGroup>
 #include <QDir>
 #include <QElapsedTimer>
+#include <QInputDialog>
 #include <QMessageBox>
 #include <QNetworkReply>
 #include <QProcess>
@@ -13,6 +17,10 @@
 #include <Common/Configuration.h>
 #include <Common/Constants.h>
 #include <Common/DatasetUtilities.h>
+#include <Common/MemoryUtilities.h>
+#include <Datasets/DatasetSpreadsheet.h>
+#include <Datasets/SpreadsheetCache.h>
+#include <Datasets/StringInterner.h>
 #include <Export/ExportVbx.h>
 #include <Import/ImportData.h>
 #include <ModelsAndViews/FilteringProxyModel.h>
@@ -24,9 +32,11 @@
 #include "About.h"
 #include "CheckUpdates.h"
 #include "DataView.h"
+#include "DatasetLoader.h"
 #include "Export.h"
 #include "FiltersDock.h"
 #include "SaveDatasetAs.h"
+#include "SpreadsheetCacher.h"
 #include "Tab.h"
 #include "TabWidget.h"
 
@@ -144,6 +154,7 @@ void VolbxMain::addStyleToMenu(const QString& name,
 void VolbxMain::createOptionsMenu()
 {
     addUpdatesSectionToMenu();
+    addMemorySectionToMenu();
     addStylesSectionToMenu();
 }
 
@@ -154,6 +165,34 @@ void VolbxMain::addUpdatesSectionToMenu()
     ui_->menuOptions->addAction(ui_->actionUpdateAuto);
 }
 
+void VolbxMain::addMemorySectionToMenu()
+{
+    ui_->menuOptions->addSection(tr("Memory"));
+    auto* spillAction{
+        ui_->menuOptions->addAction(tr("Page large columns to disk"))};
+    spillAction->setCheckable(true);
+    spillAction->setChecked(Configuration::getInstance().isSpillingEnabled());
+    connect(spillAction, &QAction::toggled, this, [](bool enabled) {
+        Configuration::getInstance().setSpillingEnabled(enabled);
+    });
+
+    auto* cacheAction{
+        ui_->menuOptions->addAction(tr("Spreadsheets cache size..."))};
+    connect(cacheAction, &QAction::triggered, this, [this]() {
+        bool ok{false};
+        const int cacheSize{QInputDialog::getInt(
+            this, tr("Spreadsheets cache"),
+            tr("Size of converted spreadsheets kept for reuse [MB], 0 to "
+               "disable:"),
+            static_cast<int>(
+                Configuration::getInstance().getSpreadsheetCacheSize()),
+            0, std::numeric_limits<int>::max(), 1, &ok)};
+        if (ok)
+            Configuration::getInstance().setSpreadsheetCacheSize(
+                static_cast<unsigned int>(cacheSize));
+    });
+}
+
 void VolbxMain::addStylesSectionToMenu()
 {
     ui_->menuOptions->addSection(tr("Styles"));
@@ -219,6 +258,7 @@ void VolbxMain::tabWasChanged(int index)
     if (index != -1)
         filters_.showFiltersForModel(tabWidget_.getCurrentProxyModel());
     manageActions(index != -1);
+    updateMemoryStatus();
 }
 
 void VolbxMain::closeEvent(QCloseEvent* event)
@@ -244,6 +284,7 @@ void VolbxMain::closeTab(int tab)
     tabWidget_.removeTab(tab);
 
     manageActions(tabWidget_.count() != 0);
+    updateMemoryStatus();
 }
 
 void VolbxMain::actionExportTriggered()
@@ -343,47 +384,145 @@ void VolbxMain::importDataset(std::unique_ptr<Dataset> dataset)
         return;
     }
 
-    const QString barTitle{
-        Constants::getProgressBarTitle(Constants::BarTitle::LOADING)};
-    ProgressBarCounter bar(barTitle, Constants::getProgressBarFullCounter(),
-                           nullptr);
-    QObject::connect(dataset.get(), &Dataset::loadingPercentChanged, &bar,
-                     &ProgressBarCounter::updateProgress);
-    bar.showDetached();
+    // Spilled columns do not count into memory needed for loading.
+    if (Configuration::getInstance().isSpillingEnabled())
+        dataset->setSpillDirectory(DatasetUtilities::getSpillDir());
 
-    QApplication::processEvents();
+    const Admission admission{admitLoading(*dataset)};
+    if (admission == Admission::CHOOSE_COLUMNS)
+        chooseColumns(std::move(dataset));
+    if (admission != Admission::LOAD)
+        return;
 
-    QElapsedTimer performanceTimer;
-    performanceTimer.start();
+    const QString cacheKey{getSpreadsheetCacheKey(*dataset)};
 
-    try
-    {
-        dataset->loadData();
-    }
-    catch (std::bad_alloc&)
+    // Data is loaded on worker thread, other tabs can be used meanwhile.
+    auto* loader{new DatasetLoader(std::move(dataset), this)};
+    connect(loader, &DatasetLoader::finished, this,
+            [this, loader, cacheKey]()
+            {
+                datasetLoaded(*loader, cacheKey);
+                loader->deleteLater();
+            });
+    loader->start();
+}
+
+void VolbxMain::datasetLoaded(DatasetLoader& loader, const QString& cacheKey)
+{
+    if (loader.wasOutOfMemory())
     {
         QString message(tr("Not enough memory to open data. "));
         message.append(tr("Close not needed data,"));
         message.append(
             tr(" pick smaller set or use another instance of application."));
         QMessageBox::critical(this, tr("Memory problem"), message);
-
         return;
     }
 
-    LOG(LogTypes::IMPORT_EXPORT,
-        "Loaded file having " + QString::number(dataset->rowCount()) +
-            " rows in time " +
-            Constants::timeFromTimeToSeconds(performanceTimer) + " seconds.");
+    if (loader.wasCancelled())
+    {
+        ui_->statusBar->showMessage(loader.getDatasetName() + " " +
+                                    tr("loading cancelled"));
+        return;
+    }
 
+    std::unique_ptr<Dataset> dataset{loader.takeDataset()};
+    if (!cacheKey.isEmpty())
+        cacheSpreadsheet(*dataset, cacheKey);
     addMainTabForDataset(std::move(dataset));
 }
 
+QString VolbxMain::getSpreadsheetCacheKey(const Dataset& dataset)
+{
+    const auto* spreadsheet{dynamic_cast<const DatasetSpreadsheet*>(&dataset)};
+    if (spreadsheet == nullptr || !spreadsheet->isWholeSheetLoaded() ||
+        Configuration::getInstance().getSpreadsheetCacheSize() == 0)
+        return {};
+    return SpreadsheetCache::computeKey(spreadsheet->getFilePath(),
+                                        spreadsheet->getSheetName());
+}
+
+void VolbxMain::cacheSpreadsheet(const Dataset& dataset,
+                                 const QString& cacheKey)
+{
+    // Loaded spreadsheet is stored as columnar .vbx on worker thread, so next
+    // import of unchanged file skips parsing of spreadsheet.
+    auto* cacher{new SpreadsheetCacher(dataset, cacheKey, this)};
+    connect(cacher, &SpreadsheetCacher::finished, cacher,
+            &QObject::deleteLater);
+    cacher->start();
+}
+
+VolbxMain::Admission VolbxMain::admitLoading(Dataset& dataset)
+{
+    const quint64 neededMemory{dataset.estimateMemoryUsage()};
+    const quint64 availableMemory{MemoryUtilities::getAvailableMemory()};
+    LOG(LogTypes::MEMORY,
+        "Loading " + dataset.getName() + " needs about " +
+            Constants::bytesToMegabytes(neededMemory) + " MB, available " +
+            Constants::bytesToMegabytes(availableMemory) + " MB.");
+    if (availableMemory == 0 || neededMemory <= availableMemory)
+        return Admission::LOAD;
+
+    QString message(tr("Loading data needs about ") +
+                    Constants::bytesToMegabytes(neededMemory) + " MB " +
+                    tr("while only ") +
+                    Constants::bytesToMegabytes(availableMemory) + " MB " +
+                    tr("is available."));
+    message.append(tr(" Load only first rows, choose fewer columns or abort."));
+    QMessageBox messageBox(QMessageBox::Warning, tr("Memory problem"), message,
+                           QMessageBox::NoButton, this);
+    const auto* rowsButton{
+        messageBox.addButton(tr("Load first rows"), QMessageBox::AcceptRole)};
+    const auto* columnsButton{
+        messageBox.addButton(tr("Choose columns"), QMessageBox::ActionRole)};
+    messageBox.addButton(QMessageBox::Abort);
+    messageBox.exec();
+
+    if (messageBox.clickedButton() == columnsButton)
+        return Admission::CHOOSE_COLUMNS;
+
+    if (messageBox.clickedButton() != rowsButton)
+        return Admission::ABORT;
+
+    const int rowCount{static_cast<int>(dataset.rowCount())};
+    const auto fittingRows{static_cast<int>(
+        static_cast<double>(rowCount) * static_cast<double>(availableMemory) /
+        static_cast<double>(neededMemory))};
+    bool ok{false};
+    const int rowLimit{QInputDialog::getInt(
+        this, tr("Load first rows"), tr("Number of rows to load:"),
+        std::max(fittingRows, 1), 1, rowCount, 1, &ok)};
+    if (!ok)
+        return Admission::ABORT;
+
+    dataset.limitRows(static_cast<unsigned int>(rowLimit));
+    LOG(LogTypes::MEMORY,
+        "Loading limited to " + QString::number(rowLimit) + " rows.");
+    return Admission::LOAD;
+}
+
+void VolbxMain::chooseColumns(std::unique_ptr<Dataset> dataset)
+{
+    // Dataset is shown again with columns chosen so far, so user changes
+    // only choices instead of selecting data from scratch.
+    ImportData import(std::move(dataset), this);
+    if (import.exec() != QDialog::Accepted)
+        return;
+
+    for (auto& chosenDataset : import.getSelectedDatasets())
+        importDataset(std::move(chosenDataset));
+}
+
 void VolbxMain::actionImportDataTriggered()
 {
     ImportData import(this);
-    if (import.exec() == QDialog::Accepted)
-        importDataset(import.getSelectedDataset());
+    if (import.exec() != QDialog::Accepted)
+        return;
+
+    // Each dataset is loaded on its own thread and gets tab once loaded.
+    for (auto& dataset : import.getSelectedDatasets())
+        importDataset(std::move(dataset));
 }
 
 QString VolbxMain::createNameForTab(const std::unique_ptr<Dataset>& dataset)
@@ -407,12 +546,68 @@ void VolbxMain::addMainTabForDataset(std::unique_ptr<Dataset> dataset)
 
     manageActions(true);
 
-    ui_->statusBar->showMessage(datasetName + " " + tr("loaded"));
+    logMemoryUsage(mainTab);
+    updateMemoryStatus();
+    ui_->statusBar->showMessage(
+        datasetName + " " + tr("loaded") + ", " +
+        Constants::bytesToMegabytes(mainTab->getMemoryUsage().total()) +
+        " MB " + tr("used"));
 }
 
 void VolbxMain::setupStatusBar()
 {
     ui_->statusBar->showMessage(tr("Ready") + "...");
+    ui_->statusBar->addPermanentWidget(&memoryLabel_);
+    updateMemoryStatus();
+}
+
+void VolbxMain::updateMemoryStatus()
+{
+    if (tabWidget_.count() == 0)
+    {
+        memoryLabel_.clear();
+        return;
+    }
+
+    memoryLabel_.setText(
+        tr("Memory") + ": " +
+        Constants::bytesToMegabytes(
+            tabWidget_.getCurrentMemoryUsage().total()) +
+        " MB " + tr("in tab") + ", " +
+        Constants::bytesToMegabytes(tabWidget_.getTotalMemoryUsage().total()) +
+        " MB " + tr("in all tabs"));
+}
+
+void VolbxMain::logMemoryUsage(const Tab* tab)
+{
+    const TableModel* model{tab->getCurrentTableModel()};
+    for (int column = 0; column < model->columnCount(); ++column)
+    {
+        const MemoryUsage columnMemory{model->getColumnMemoryUsage(column)};
+        LOG(LogTypes::MEMORY,
+            "Column " + model->headerData(column, Qt::Horizontal).toString() +
+                " (" + model->getColumnEncodingName(column) + "): values " +
+                QString::number(columnMemory.values_) +
+                " B, dictionary " +
+                QString::number(columnMemory.dictionaries_) + " B.");
+    }
+
+    const MemoryUsage memoryUsage{tab->getMemoryUsage()};
+    LOG(LogTypes::MEMORY,
+        tab->windowTitle() + " uses " +
+            Constants::bytesToMegabytes(memoryUsage.total()) +
+            " MB (values " + QString::number(memoryUsage.values_) +
+            " B, dictionaries " + QString::number(memoryUsage.dictionaries_) +
+            " B, shared strings " +
+            QString::number(memoryUsage.sharedStrings_) +
+            " B, proxy mappings " +
+            QString::number(memoryUsage.proxyMappings_) + " B, spilled " +
+            QString::number(memoryUsage.spilled_) + " B).");
+
+    const StringInterner& interner{StringInterner::getInstance()};
+    LOG(LogTypes::MEMORY,
+        "Strings shared by all tabs: " + QString::number(interner.size()) +
+            " using " + QString::number(interner.getMemoryUsage()) + " B.");
 }
 
 bool VolbxMain::canUpdate(QNetworkReply* reply)
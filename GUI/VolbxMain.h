@@ -2,6 +2,7 @@
 
 #include <memory>
 
+#include <QLabel>
 #include <QMainWindow>
 #include <QNetworkAccessManager>
 
@@ -12,6 +13,7 @@
 
 class QActionGroup;
 class Dataset;
+class DatasetLoader;
 
 /**
  * @brief Volbx main window.
@@ -48,10 +50,16 @@ private:
 
     void setupStatusBar();
 
+    void updateMemoryStatus();
+
+    static void logMemoryUsage(const Tab* tab);
+
     void createOptionsMenu();
 
     void addUpdatesSectionToMenu();
 
+    void addMemorySectionToMenu();
+
     void addStylesSectionToMenu();
 
     void addStylesFoundInAppDir(QActionGroup* actionsGroup);
@@ -68,6 +76,24 @@ private:
 
     void importDataset(std::unique_ptr<Dataset> dataset);
 
+    /// Decision taken when dataset may not fit in memory.
+    enum class Admission : unsigned char
+    {
+        LOAD,
+        CHOOSE_COLUMNS,
+        ABORT
+    };
+
+    Admission admitLoading(Dataset& dataset);
+
+    void chooseColumns(std::unique_ptr<Dataset> dataset);
+
+    void datasetLoaded(DatasetLoader& loader, const QString& cacheKey);
+
+    static QString getSpreadsheetCacheKey(const Dataset& dataset);
+
+    void cacheSpreadsheet(const Dataset& dataset, const QString& cacheKey);
+
     static QString createNameForTab(const std::unique_ptr<Dataset>& dataset);
 
     bool canUpdate(QNetworkReply* reply);
@@ -85,6 +111,9 @@ private:
     /// Network manager used to retrieve current available version.
     QNetworkAccessManager networkManager_;
 
+    /// Permanent status bar label with memory used by tabs.
+    QLabel memoryLabel_;
+
 private Q_SLOTS:
     void tabWasChanged(int index);
 
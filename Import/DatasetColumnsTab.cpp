@@ -0,0 +1,28 @@
+#include "DatasetColumnsTab.h"
+
+#include <QSplitter>
+#include <QVBoxLayout>
+
+#include <Datasets/Dataset.h>
+
+#include "ColumnsPreview.h"
+#include "DatasetVisualization.h"
+
+DatasetColumnsTab::DatasetColumnsTab(std::unique_ptr<Dataset> dataset,
+                                     QWidget* parent)
+    : ImportTab(parent)
+{
+    auto [visualization, columnsPreview] =
+        createVisualizationAndColumnPreview();
+
+    auto* centralSplitter{new QSplitter(Qt::Vertical, this)};
+    centralSplitter->addWidget(visualization);
+    centralSplitter->addWidget(columnsPreview);
+
+    auto* layout{new QVBoxLayout(this)};
+    layout->setContentsMargins(2, 2, 2, 2);
+    layout->addWidget(centralSplitter);
+    setLayout(layout);
+
+    setDataset(std::move(dataset));
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <memory>
+
+#include "ImportTab.h"
+
+class Dataset;
+
+/**
+ * @brief Import tab for changing choices made for already selected dataset,
+ * like active columns when loading whole dataset does not fit in memory.
+ */
+class DatasetColumnsTab : public ImportTab
+{
+    Q_OBJECT
+public:
+    explicit DatasetColumnsTab(std::unique_ptr<Dataset> dataset,
+                               QWidget* parent = nullptr);
+};
@@ -1,6 +1,6 @@
 #include "DatasetImportTab.h"
 
-#include <DatasetInner.h>
+#include <Datasets/DatasetInner.h>
 #include <QHeaderView>
 #include <QMessageBox>
 #include <QSplitter>
@@ -31,12 +31,18 @@ DatasetImportTab::DatasetImportTab(QWidget* parent) : ImportTab(parent)
 
     connect(listBrowser, &DatasetsListBrowser::currentDatasetChanged, this,
             &DatasetImportTab::selectedDatasetChanged);
+    connect(listBrowser, &DatasetsListBrowser::datasetAboutToBeRemoved, this,
+            &DatasetImportTab::releaseDataset);
+    connect(&previewLoader_, &DatasetPreviewLoader::finished, this,
+            &DatasetImportTab::previewFinished);
 }
 
 void DatasetImportTab::selectedDatasetChanged(const QString& current)
 {
+    storeDisplayedDataset();
     if (current.isEmpty())
     {
+        previewLoader_.cancel();
         clear();
         auto* listBrowser{findChild<DatasetsListBrowser*>()};
         listBrowser->clearSelection();
@@ -65,10 +71,30 @@ void DatasetImportTab::clear()
 
 void DatasetImportTab::createDataset(const QString& datasetName)
 {
-    std::unique_ptr<Dataset> dataset{
-        std::make_unique<DatasetInner>(datasetName)};
+    std::unique_ptr<Dataset> dataset{previewLoader_.take(datasetName)};
+    if (dataset != nullptr)
+    {
+        previewLoader_.cancel();
+        setDataset(std::move(dataset));
+        return;
+    }
 
-    if (dataset->initialize() && dataset->isValid())
+    clear();
+    previewLoader_.start(std::make_unique<DatasetInner>(datasetName));
+}
+
+void DatasetImportTab::storeDisplayedDataset()
+{
+    auto* visualization{findChild<DatasetVisualization*>()};
+    std::unique_ptr<Dataset> dataset{visualization->takeDataset()};
+    if (dataset != nullptr)
+        previewLoader_.store(std::move(dataset));
+}
+
+void DatasetImportTab::previewFinished(const QString& datasetName)
+{
+    std::unique_ptr<Dataset> dataset{previewLoader_.take(datasetName)};
+    if (dataset != nullptr)
     {
         setDataset(std::move(dataset));
     }
@@ -80,3 +106,10 @@ void DatasetImportTab::createDataset(const QString& datasetName)
             tr("Dataset ") + datasetName + tr(" is damaged."));
     }
 }
+
+void DatasetImportTab::releaseDataset(const QString& datasetName)
+{
+    previewLoader_.cancel();
+    previewLoader_.remove(datasetName);
+    clear();
+}
@@ -2,6 +2,7 @@
 
 #include <memory>
 
+#include "DatasetPreviewLoader.h"
 #include "ImportTab.h"
 
 class Dataset;
@@ -22,6 +23,15 @@ private:
 
     void createDataset(const QString& datasetName);
 
+    void storeDisplayedDataset();
+
+    /// Prepares previews of selected datasets without blocking GUI.
+    DatasetPreviewLoader previewLoader_;
+
 private Q_SLOTS:
     void selectedDatasetChanged(const QString& current);
+
+    void previewFinished(const QString& datasetName);
+
+    void releaseDataset(const QString& datasetName);
 };
@@ -0,0 +1,111 @@
+#include "DatasetPreviewLoader.h"
+
+#include <algorithm>
+#include <new>
+
+#include <QThread>
+
+#include <Datasets/Dataset.h>
+#include <Shared/Logger.h>
+
+DatasetPreviewLoader::DatasetPreviewLoader(QObject* parent) : QObject(parent)
+{
+}
+
+DatasetPreviewLoader::~DatasetPreviewLoader()
+{
+    cancel();
+    for (const auto& preview : running_)
+        preview->thread_->wait();
+}
+
+void DatasetPreviewLoader::start(std::unique_ptr<Dataset> dataset)
+{
+    cancel();
+    add(std::move(dataset));
+}
+
+void DatasetPreviewLoader::add(std::unique_ptr<Dataset> dataset)
+{
+    auto preview{std::make_unique<Preview>()};
+    preview->dataset_ = std::move(dataset);
+    Preview* startedPreview{preview.get()};
+    preview->thread_.reset(QThread::create(
+        [startedPreview]()
+        {
+            try
+            {
+                startedPreview->success_ =
+                    startedPreview->dataset_->initialize() &&
+                    startedPreview->dataset_->isValid();
+            }
+            catch (std::bad_alloc&)
+            {
+                startedPreview->success_ = false;
+            }
+        }));
+    connect(preview->thread_.get(), &QThread::finished, this,
+            [this, startedPreview]() { previewFinished(startedPreview); });
+    running_.push_back(std::move(preview));
+    startedPreview->thread_->start();
+}
+
+void DatasetPreviewLoader::cancel()
+{
+    for (const auto& preview : running_)
+    {
+        preview->cancelled_ = true;
+        preview->dataset_->cancelLoading();
+    }
+}
+
+std::unique_ptr<Dataset> DatasetPreviewLoader::take(const QString& datasetName)
+{
+    const auto it{std::find_if(
+        recent_.begin(), recent_.end(), [&datasetName](const auto& dataset)
+        { return dataset->getName() == datasetName; })};
+    if (it == recent_.end())
+        return nullptr;
+
+    std::unique_ptr<Dataset> dataset{std::move(*it)};
+    recent_.erase(it);
+    return dataset;
+}
+
+void DatasetPreviewLoader::store(std::unique_ptr<Dataset> dataset)
+{
+    remove(dataset->getName());
+    recent_.push_front(std::move(dataset));
+    if (recent_.size() > RECENT_PREVIEWS_LIMIT)
+        recent_.pop_back();
+}
+
+void DatasetPreviewLoader::remove(const QString& datasetName)
+{
+    recent_.remove_if([&datasetName](const auto& dataset)
+                      { return dataset->getName() == datasetName; });
+}
+
+void DatasetPreviewLoader::previewFinished(const Preview* preview)
+{
+    const auto it{std::find_if(running_.begin(), running_.end(),
+                               [preview](const auto& runningPreview)
+                               { return runningPreview.get() == preview; })};
+    Q_ASSERT(it != running_.end());
+    std::unique_ptr<Preview> finishedPreview{std::move(*it)};
+    running_.erase(it);
+
+    // Thread object is still emitting finished(), release it later.
+    finishedPreview->thread_.release()->deleteLater();
+
+    if (finishedPreview->cancelled_)
+        return;
+
+    const QString datasetName{finishedPreview->dataset_->getName()};
+    if (finishedPreview->success_)
+        store(std::move(finishedPreview->dataset_));
+    else
+        LOG(LogTypes::IMPORT_EXPORT,
+            "Preview of dataset " + datasetName + " can not be prepared.");
+    Q_EMIT finished(datasetName);
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <vector>
+
+#include <QObject>
+
+class Dataset;
+class QThread;
+
+/**
+ * @brief Prepares previews of datasets (definition, strings and sample) on
+ * worker threads and keeps recently used previews for reuse.
+ */
+class DatasetPreviewLoader : public QObject
+{
+    Q_OBJECT
+public:
+    explicit DatasetPreviewLoader(QObject* parent = nullptr);
+
+    ~DatasetPreviewLoader() override;
+
+    DatasetPreviewLoader& operator=(const DatasetPreviewLoader& other) = delete;
+    DatasetPreviewLoader(const DatasetPreviewLoader& other) = delete;
+
+    DatasetPreviewLoader& operator=(DatasetPreviewLoader&& other) = delete;
+    DatasetPreviewLoader(DatasetPreviewLoader&& other) = delete;
+
+    /**
+     * @brief Start preparing preview of dataset. Previews started earlier and
+     * not finished yet are cancelled.
+     * @param dataset Dataset to initialize.
+     */
+    void start(std::unique_ptr<Dataset> dataset);
+
+    /**
+     * @brief Start preparing preview of dataset while previews started
+     * earlier are still being prepared.
+     * @param dataset Dataset to initialize.
+     */
+    void add(std::unique_ptr<Dataset> dataset);
+
+    /**
+     * @brief Cancel previews being prepared, finished() is not emitted for
+     * them.
+     */
+    void cancel();
+
+    /**
+     * @brief Take prepared preview out of recently used ones.
+     * @param datasetName Name of dataset.
+     * @return Initialized dataset or nullptr if there is no such preview.
+     */
+    std::unique_ptr<Dataset> take(const QString& datasetName);
+
+    /**
+     * @brief Keep preview no longer displayed as most recently used one.
+     * Least recently used preview is released when limit is exceeded.
+     * @param dataset Initialized dataset.
+     */
+    void store(std::unique_ptr<Dataset> dataset);
+
+    /**
+     * @brief Release preview of dataset, e.g. before removing its file.
+     * @param datasetName Name of dataset.
+     */
+    void remove(const QString& datasetName);
+
+Q_SIGNALS:
+    /**
+     * @brief Emitted on GUI thread when preview of dataset is prepared. When
+     * preparing succeeded, preview can be retrieved using take().
+     * @param datasetName Name of dataset.
+     */
+    void finished(const QString& datasetName);
+
+private:
+    /// Dataset initialized on worker thread.
+    struct Preview
+    {
+        std::unique_ptr<Dataset> dataset_;
+
+        std::unique_ptr<QThread> thread_;
+
+        bool success_{false};
+
+        bool cancelled_{false};
+    };
+
+    void previewFinished(const Preview* preview);
+
+    /// Previews being prepared, cancelled ones stay until threads end.
+    std::vector<std::unique_ptr<Preview>> running_;
+
+    /// Prepared previews, most recently used first.
+    std::list<std::unique_ptr<Dataset>> recent_;
+
+    /// Number of prepared previews kept, each keeps strings of dataset.
+    static constexpr std::size_t RECENT_PREVIEWS_LIMIT{4};
+};
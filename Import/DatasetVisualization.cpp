@@ -28,6 +28,11 @@ DatasetVisualization::DatasetVisualization(QWidget* parent)
 
     connect(ui_->UnselectAll, &QPushButton::clicked, this,
             &DatasetVisualization::unselectAllClicked);
+
+    connect(ui_->loadFilterCheckBox, &QCheckBox::toggled,
+            ui_->loadFromDateEdit, &QDateEdit::setEnabled);
+    connect(ui_->loadFilterCheckBox, &QCheckBox::toggled, ui_->loadToDateEdit,
+            &QDateEdit::setEnabled);
 }
 
 void DatasetVisualization::setDataset(std::unique_ptr<Dataset> dataset)
@@ -42,9 +47,45 @@ void DatasetVisualization::setDataset(std::unique_ptr<Dataset> dataset)
 
     setTaggedColumns();
 
+    setupLoadFilterWidgets();
+
     ui_->taggedColumnsWidget->setEnabled(true);
 
     refreshColumnList(0);
+
+    // Dataset returned for changes keeps columns chosen earlier.
+    const QVector<bool> activeColumns{dataset_->getActiveColumns()};
+    if (!activeColumns.isEmpty())
+        checkActiveColumns(activeColumns);
+}
+
+void DatasetVisualization::replaceDataset(std::unique_ptr<Dataset> dataset)
+{
+    const QVector<bool> activeColumns{getActiveColumns()};
+    const int dateColumn{getCurrentValueFromCombo(ui_->dateCombo)};
+    const int priceColumn{getCurrentValueFromCombo(ui_->pricePerUnitCombo)};
+
+    setDataset(std::move(dataset));
+
+    setCurrentIndexUsingColumn(ui_->dateCombo, dateColumn);
+    setCurrentIndexUsingColumn(ui_->pricePerUnitCombo, priceColumn);
+
+    checkActiveColumns(activeColumns);
+}
+
+void DatasetVisualization::checkActiveColumns(
+    const QVector<bool>& activeColumns)
+{
+    const int topLevelItemsCount{ui_->columnsList->topLevelItemCount()};
+    for (int i = 0; i < topLevelItemsCount; ++i)
+    {
+        QTreeWidgetItem* currentItem{ui_->columnsList->topLevelItem(i)};
+        const int column{currentItem->data(0, Qt::UserRole).toInt()};
+        if (currentItem->flags().testFlag(Qt::ItemIsUserCheckable) &&
+            column < activeColumns.size())
+            currentItem->setCheckState(
+                0, activeColumns[column] ? Qt::Checked : Qt::Unchecked);
+    }
 }
 
 void DatasetVisualization::clear()
@@ -79,9 +120,24 @@ std::unique_ptr<Dataset> DatasetVisualization::retrieveDataset()
     setTaggedColumnInDataset(ColumnTag::DATE, ui_->dateCombo);
     setTaggedColumnInDataset(ColumnTag::VALUE, ui_->pricePerUnitCombo);
 
+    const int dateColumn{getCurrentValueFromCombo(ui_->dateCombo)};
+    if (!ui_->loadFilterCheckBox->isHidden() &&
+        ui_->loadFilterCheckBox->isChecked() &&
+        dateColumn != Constants::NOT_SET_COLUMN)
+        dataset_->setLoadFilter(LoadFilter::createDateFilter(
+            dateColumn, ui_->loadFromDateEdit->date(),
+            ui_->loadToDateEdit->date()));
+
     return std::move(dataset_);
 }
 
+std::unique_ptr<Dataset> DatasetVisualization::takeDataset()
+{
+    std::unique_ptr<Dataset> dataset{std::move(dataset_)};
+    clear();
+    return dataset;
+}
+
 void DatasetVisualization::currentColumnOnTreeChanged(
     QTreeWidgetItem* current, [[maybe_unused]] QTreeWidgetItem* previous)
 {
@@ -167,6 +223,20 @@ void DatasetVisualization::setTaggedColumns()
     ui_->pricePerUnitCombo->blockSignals(false);
 }
 
+void DatasetVisualization::setupLoadFilterWidgets()
+{
+    // Only datasets with zone maps can skip rows while loading.
+    const bool supported{dataset_->supportsLoadFilter() &&
+                         ui_->dateCombo->count() > 0};
+    ui_->loadFilterCheckBox->setVisible(supported);
+    ui_->loadFromDateEdit->setVisible(supported);
+    ui_->loadToDateEdit->setVisible(supported);
+    ui_->loadFilterCheckBox->setChecked(false);
+    const QDate today{QDate::currentDate()};
+    ui_->loadFromDateEdit->setDate(today.addMonths(-3));
+    ui_->loadToDateEdit->setDate(today);
+}
+
 QVector<bool> DatasetVisualization::getActiveColumns() const
 {
     const int topLevelItemsCount{ui_->columnsList->topLevelItemCount()};
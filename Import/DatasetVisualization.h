@@ -23,10 +23,24 @@ public:
 
     void setDataset(std::unique_ptr<Dataset> dataset);
 
+    /**
+     * @brief Replace displayed dataset with one having the same columns.
+     * Selected columns and tagged columns chosen by user are kept.
+     * @param dataset Initialized dataset.
+     */
+    void replaceDataset(std::unique_ptr<Dataset> dataset);
+
     void clear();
 
     std::unique_ptr<Dataset> retrieveDataset();
 
+    /**
+     * @brief Take displayed dataset without applying choices made by user.
+     * Widget is cleared afterwards.
+     * @return Displayed dataset or nullptr.
+     */
+    std::unique_ptr<Dataset> takeDataset();
+
 public Q_SLOTS:
     /**
      * Triggered when currently selected column in linked widget changed.
@@ -42,8 +56,12 @@ private:
 
     void setTaggedColumns();
 
+    void setupLoadFilterWidgets();
+
     QVector<bool> getActiveColumns() const;
 
+    void checkActiveColumns(const QVector<bool>& activeColumns);
+
     void setTaggedColumnInDataset(ColumnTag tag, QComboBox* combo);
 
     QString getTypeDisplayNameForGivenColumn(int column) const;
@@ -18,10 +18,11 @@ DatasetsListBrowser::DatasetsListBrowser(QWidget* parent)
 
 void DatasetsListBrowser::searchTextChanged(const QString& arg1)
 {
-    for (int i = 0; i < ui_->datasetsList->count(); ++i)
+    for (int i = 0; i < ui_->datasetsList->topLevelItemCount(); ++i)
     {
-        QListWidgetItem* item{ui_->datasetsList->item(i)};
-        const bool hide{!item->text().contains(arg1, Qt::CaseInsensitive)};
+        QTreeWidgetItem* item{ui_->datasetsList->topLevelItem(i)};
+        const bool hide{
+            !item->text(NAME).contains(arg1, Qt::CaseInsensitive)};
         item->setHidden(hide);
     }
 }
@@ -33,23 +34,74 @@ void DatasetsListBrowser::clearSelection()
 
 bool DatasetsListBrowser::isDatasetsListEmpty() const
 {
-    return (ui_->datasetsList->count() == 0);
+    return (ui_->datasetsList->topLevelItemCount() == 0);
 }
 
 void DatasetsListBrowser::setupDatasetsList()
 {
-    ui_->datasetsList->insertItems(
-        0, DatasetUtilities::getListOfAvailableDatasets());
+    ui_->datasetsList->header()->setSectionsMovable(false);
+
+    fillDatasetsList();
 
     ui_->datasetsList->setContextMenuPolicy(Qt::CustomContextMenu);
 
-    connect(ui_->datasetsList, &QListWidget::customContextMenuRequested, this,
+    connect(ui_->datasetsList, &QTreeWidget::customContextMenuRequested, this,
             &DatasetsListBrowser::showContextMenu);
 
-    connect(ui_->datasetsList, &QListWidget::itemSelectionChanged, this,
+    connect(ui_->datasetsList, &QTreeWidget::itemSelectionChanged, this,
             &DatasetsListBrowser::datasetsListItemSelectionChanged);
 }
 
+void DatasetsListBrowser::fillDatasetsList()
+{
+    ui_->datasetsList->clear();
+
+    // Catalog opens only datasets added or changed since last use.
+    DatasetCatalog catalog;
+    catalog.refresh();
+    for (const auto& entry : catalog.getEntries())
+        ui_->datasetsList->addTopLevelItem(createItem(entry));
+
+    ui_->datasetsList->sortByColumn(NAME, Qt::AscendingOrder);
+    ui_->datasetsList->header()->resizeSections(QHeaderView::ResizeToContents);
+}
+
+QTreeWidgetItem* DatasetsListBrowser::createItem(
+    const DatasetCatalog::Entry& entry)
+{
+    auto* item{new QTreeWidgetItem()};
+    item->setText(NAME, entry.name_);
+    item->setToolTip(NAME, createToolTip(entry));
+    item->setData(ROWS, Qt::DisplayRole, entry.rowCount_);
+    item->setData(COLUMNS, Qt::DisplayRole,
+                  static_cast<int>(entry.columnTypes_.size()));
+    const qint64 bytesInKilobyte{1024};
+    item->setData(SIZE, Qt::DisplayRole,
+                  (entry.size_ + bytesInKilobyte - 1) / bytesInKilobyte);
+    item->setData(MODIFIED, Qt::DisplayRole, entry.lastModified_);
+    return item;
+}
+
+QString DatasetsListBrowser::createToolTip(const DatasetCatalog::Entry& entry)
+{
+    const auto countColumns{[&entry](ColumnType columnType)
+                            {
+                                return QString::number(
+                                    entry.columnTypes_.count(columnType));
+                            }};
+    QString toolTip{tr("Names: ") + countColumns(ColumnType::STRING) + "\n" +
+                    tr("Numbers: ") + countColumns(ColumnType::NUMBER) +
+                    "\n" + tr("Dates: ") + countColumns(ColumnType::DATE)};
+    if (entry.taggedColumns_.contains(ColumnTag::DATE))
+        toolTip += "\n" + tr("Time column: ") +
+                   QString::number(entry.taggedColumns_[ColumnTag::DATE] + 1);
+    if (entry.taggedColumns_.contains(ColumnTag::VALUE))
+        toolTip +=
+            "\n" + tr("Examined data column: ") +
+            QString::number(entry.taggedColumns_[ColumnTag::VALUE] + 1);
+    return toolTip;
+}
+
 bool DatasetsListBrowser::doesUserChooseToDeleteSelectedDataset(QPoint pos)
 {
     const QPoint globalPos{ui_->datasetsList->viewport()->mapToGlobal(pos)};
@@ -81,13 +133,12 @@ bool DatasetsListBrowser::doesUserConfirmedDeleting(
 
 void DatasetsListBrowser::deleteSelectedDataset(const QString& datasetToDelete)
 {
+    Q_EMIT datasetAboutToBeRemoved(datasetToDelete);
     if (!DatasetUtilities::removeDataset(datasetToDelete))
         QMessageBox::warning(this, tr("Error"),
                              tr("Can not delete ") + datasetToDelete + ".");
 
-    ui_->datasetsList->clear();
-    ui_->datasetsList->insertItems(
-        0, DatasetUtilities::getListOfAvailableDatasets());
+    fillDatasetsList();
 }
 
 void DatasetsListBrowser::showContextMenu(QPoint pos)
@@ -96,7 +147,7 @@ void DatasetsListBrowser::showContextMenu(QPoint pos)
         return;
 
     const QString datasetToDelete{
-        ui_->datasetsList->selectedItems().first()->text()};
+        ui_->datasetsList->selectedItems().first()->text(NAME)};
 
     if (doesUserChooseToDeleteSelectedDataset(pos) &&
         doesUserConfirmedDeleting(datasetToDelete))
@@ -106,9 +157,9 @@ void DatasetsListBrowser::showContextMenu(QPoint pos)
 void DatasetsListBrowser::datasetsListItemSelectionChanged()
 {
     QString newCurrent{QLatin1String("")};
-    QList<QListWidgetItem*> selectedItems{ui_->datasetsList->selectedItems()};
+    QList<QTreeWidgetItem*> selectedItems{ui_->datasetsList->selectedItems()};
     if (!selectedItems.isEmpty())
-        newCurrent = selectedItems.front()->text();
+        newCurrent = selectedItems.front()->text(NAME);
 
     Q_EMIT currentDatasetChanged(newCurrent);
 }
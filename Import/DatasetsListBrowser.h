@@ -4,9 +4,11 @@
 
 #include <QWidget>
 
+#include <Datasets/DatasetCatalog.h>
+
 #include "ui_DatasetsListBrowser.h"
 
-class QListWidgetItem;
+class QTreeWidgetItem;
 
 /**
  * @brief Widget for browsing list of actual datasets.
@@ -22,8 +24,24 @@ public:
     bool isDatasetsListEmpty() const;
 
 private:
+    /// Columns of datasets list.
+    enum ListColumn : int
+    {
+        NAME,
+        ROWS,
+        COLUMNS,
+        SIZE,
+        MODIFIED
+    };
+
     void setupDatasetsList();
 
+    void fillDatasetsList();
+
+    static QTreeWidgetItem* createItem(const DatasetCatalog::Entry& entry);
+
+    static QString createToolTip(const DatasetCatalog::Entry& entry);
+
     bool doesUserChooseToDeleteSelectedDataset(QPoint pos);
 
     bool doesUserConfirmedDeleting(const QString& datasetToDelete);
@@ -41,4 +59,10 @@ private Q_SLOTS:
 
 Q_SIGNALS:
     void currentDatasetChanged(QString current);
+
+    /**
+     * Emit before files of dataset are removed, so they can be released.
+     * @param datasetName Name of dataset to remove.
+     */
+    void datasetAboutToBeRemoved(QString datasetName);
 };
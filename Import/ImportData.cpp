@@ -7,20 +7,37 @@
 
 #include <Datasets/Dataset.h>
 
+#include "DatasetColumnsTab.h"
 #include "DatasetImportTab.h"
 #include "SpreadsheetsImportTab.h"
 
 ImportData::ImportData(QWidget* parent) : QDialog(parent)
 {
-    setupLayout();
+    QDialogButtonBox* buttonBox{createButtonBox()};
+    auto enableOpenButton = [=](bool activate) {
+        buttonBox->button(QDialogButtonBox::Open)->setEnabled(activate);
+    };
+    setupLayout(createTabWidgetWithContent(enableOpenButton), buttonBox);
+    setWindowFlags(windowFlags() & ~Qt::WindowContextHelpButtonHint);
+}
+
+ImportData::ImportData(std::unique_ptr<Dataset> dataset, QWidget* parent)
+    : QDialog(parent)
+{
+    QDialogButtonBox* buttonBox{createButtonBox()};
+    buttonBox->button(QDialogButtonBox::Open)->setEnabled(true);
+    auto* tabWidget{new QTabWidget(this)};
+    tabWidget->addTab(new DatasetColumnsTab(std::move(dataset), tabWidget),
+                      tr("Columns"));
+    setupLayout(tabWidget, buttonBox);
     setWindowFlags(windowFlags() & ~Qt::WindowContextHelpButtonHint);
 }
 
-std::unique_ptr<Dataset> ImportData::getSelectedDataset()
+std::vector<std::unique_ptr<Dataset>> ImportData::getSelectedDatasets()
 {
     auto* tabWidget{findChild<QTabWidget*>()};
     auto* tab{dynamic_cast<ImportTab*>(tabWidget->currentWidget())};
-    return tab->getDataset();
+    return tab->getDatasets();
 }
 
 QDialogButtonBox* ImportData::createButtonBox()
@@ -36,18 +53,12 @@ QDialogButtonBox* ImportData::createButtonBox()
     return buttonBox;
 }
 
-void ImportData::setupLayout()
+void ImportData::setupLayout(QTabWidget* tabWidget,
+                             QDialogButtonBox* buttonBox)
 {
     auto* layout{new QVBoxLayout(this)};
     layout->setSpacing(2);
     layout->setContentsMargins(2, 2, 2, 2);
-
-    QDialogButtonBox* buttonBox{createButtonBox()};
-    auto enableOpenButton = [=](bool activate) {
-        buttonBox->button(QDialogButtonBox::Open)->setEnabled(activate);
-    };
-    QTabWidget* tabWidget{createTabWidgetWithContent(enableOpenButton)};
-
     layout->addWidget(tabWidget);
     layout->addWidget(buttonBox);
 }
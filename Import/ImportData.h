@@ -2,6 +2,7 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include <QDialog>
 
@@ -19,14 +20,21 @@ class ImportData : public QDialog
 public:
     explicit ImportData(QWidget* parent = nullptr);
 
-    std::unique_ptr<Dataset> getSelectedDataset();
+    /**
+     * @brief Create dialog for changing choices made for given dataset.
+     * @param dataset Initialized dataset with choices already made.
+     * @param parent Parent widget.
+     */
+    ImportData(std::unique_ptr<Dataset> dataset, QWidget* parent);
+
+    std::vector<std::unique_ptr<Dataset>> getSelectedDatasets();
 
     QString getZipFileName() const;
 
 private:
     QDialogButtonBox* createButtonBox();
 
-    void setupLayout();
+    void setupLayout(QTabWidget* tabWidget, QDialogButtonBox* buttonBox);
 
     QTabWidget* createTabWidgetWithContent(
         const std::function<void(bool)>& enableOpenButton);
@@ -36,7 +36,15 @@ std::unique_ptr<Dataset> ImportTab::getDataset()
     return definition->retrieveDataset();
 }
 
-void ImportTab::setDataset(std::unique_ptr<Dataset> dataset)
+std::vector<std::unique_ptr<Dataset>> ImportTab::getDatasets()
+{
+    std::vector<std::unique_ptr<Dataset>> datasets;
+    datasets.push_back(getDataset());
+    return datasets;
+}
+
+void ImportTab::setDataset(std::unique_ptr<Dataset> dataset,
+                           bool readyToImport)
 {
     auto* columnsPreview{findChild<ColumnsPreview*>()};
     columnsPreview->setDatasetSampleInfo(dataset);
@@ -45,5 +53,15 @@ void ImportTab::setDataset(std::unique_ptr<Dataset> dataset)
     visualization->setDataset(std::move(dataset));
     visualization->setEnabled(true);
 
+    Q_EMIT datasetIsReady(readyToImport);
+}
+
+void ImportTab::replaceDataset(std::unique_ptr<Dataset> dataset)
+{
+    auto* columnsPreview{findChild<ColumnsPreview*>()};
+    columnsPreview->setDatasetSampleInfo(dataset);
+    auto* visualization{findChild<DatasetVisualization*>()};
+    visualization->replaceDataset(std::move(dataset));
+
     Q_EMIT datasetIsReady(true);
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include <QWidget>
 
@@ -19,11 +20,25 @@ public:
 
     std::unique_ptr<Dataset> getDataset();
 
+    /**
+     * @brief Get all datasets chosen for import.
+     * @return Datasets, displayed one by default.
+     */
+    virtual std::vector<std::unique_ptr<Dataset>> getDatasets();
+
 protected:
     std::pair<DatasetVisualization*, ColumnsPreview*>
     createVisualizationAndColumnPreview();
 
-    void setDataset(std::unique_ptr<Dataset> dataset);
+    void setDataset(std::unique_ptr<Dataset> dataset,
+                    bool readyToImport = true);
+
+    /**
+     * @brief Replace displayed dataset with one having the same columns,
+     * keeping choices already made by user.
+     * @param dataset Initialized dataset.
+     */
+    void replaceDataset(std::unique_ptr<Dataset> dataset);
 
 Q_SIGNALS:
     void datasetIsReady(bool);
@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <future>
+#include <utility>
 
 #include <ProgressBarInfinite.h>
 #include <QElapsedTimer>
@@ -10,14 +11,17 @@
 #include <QHeaderView>
 #include <QMessageBox>
 #include <QSplitter>
+#include <QStandardItemModel>
 
 #include <Common/Configuration.h>
 #include <Common/Constants.h>
 #include <Common/DatasetUtilities.h>
 #include <Datasets/Dataset.h>
+#include <Datasets/DatasetInner.h>
 #include <Datasets/DatasetOds.h>
 #include <Datasets/DatasetSpreadsheet.h>
 #include <Datasets/DatasetXlsx.h>
+#include <Datasets/SpreadsheetCache.h>
 #include <Shared/Logger.h>
 
 #include "ColumnsPreview.h"
@@ -41,6 +45,37 @@ SpreadsheetsImportTab::SpreadsheetsImportTab(QWidget* parent)
     ui_->verticalLayout->addWidget(centralSplitter);
 
     ui_->sheetCombo->hide();
+    ui_->verificationLabel->hide();
+
+    connect(ui_->sheetCombo,
+            QOverload<int>::of(&QComboBox::currentIndexChanged), this,
+            &SpreadsheetsImportTab::currentSheetChanged);
+    connect(qobject_cast<QStandardItemModel*>(ui_->sheetCombo->model()),
+            &QStandardItemModel::itemChanged, this,
+            &SpreadsheetsImportTab::sheetCheckChanged);
+
+    connect(&analysisLoader_, &DatasetPreviewLoader::finished, this,
+            &SpreadsheetsImportTab::analysisFinished);
+}
+
+std::vector<std::unique_ptr<Dataset>> SpreadsheetsImportTab::getDatasets()
+{
+    std::vector<std::unique_ptr<Dataset>> datasets;
+    for (const QString& sheetName : getCheckedSheets())
+    {
+        if (sheetName == displayedSheet_)
+        {
+            datasets.push_back(getDataset());
+            continue;
+        }
+
+        const auto it{sheetDatasets_.find(sheetName)};
+        if (it == sheetDatasets_.end())
+            continue;
+        datasets.push_back(std::move(it->second));
+        sheetDatasets_.erase(it);
+    }
+    return datasets;
 }
 
 void SpreadsheetsImportTab::analyzeFile(std::unique_ptr<Dataset>& dataset)
@@ -71,33 +106,64 @@ void SpreadsheetsImportTab::analyzeFile(std::unique_ptr<Dataset>& dataset)
             Constants::timeFromTimeToSeconds(performanceTimer) + " seconds.");
 }
 
-std::unique_ptr<Dataset> SpreadsheetsImportTab::createDataset(
-    const QFileInfo& fileInfo)
+std::unique_ptr<DatasetSpreadsheet> SpreadsheetsImportTab::createDataset(
+    const QString& sheetName) const
 {
-    const QString datasetName{getValidDatasetName(fileInfo)};
-    const QString datasetFilePath{fileInfo.canonicalFilePath()};
+    const QString datasetName{getDatasetName(sheetName)};
+    const QString datasetFilePath{fileInfo_.canonicalFilePath()};
 
     std::unique_ptr<DatasetSpreadsheet> dataset{nullptr};
-    if (fileInfo.suffix().toLower().compare(QStringLiteral("ods")) == 0)
+    if (fileInfo_.suffix().toLower().compare(QStringLiteral("ods")) == 0)
         dataset = std::make_unique<DatasetOds>(datasetName, datasetFilePath);
 
-    if (fileInfo.suffix().toLower().compare(QStringLiteral("xlsx")) == 0)
-        dataset = std::make_unique<DatasetXlsx>(datasetName, datasetFilePath);
+    if (isXlsx())
+    {
+        auto xlsx{std::make_unique<DatasetXlsx>(datasetName, datasetFilePath)};
+        if (sharedStringsLoaded_)
+            xlsx->setSharedStrings(sharedStrings_);
+        dataset = std::move(xlsx);
+    }
+
+    if (dataset != nullptr && !sheetName.isEmpty())
+        dataset->setSheetName(sheetName);
 
     return dataset;
 }
 
+std::unique_ptr<Dataset> SpreadsheetsImportTab::createCachedDataset(
+    const QString& sheetName) const
+{
+    const unsigned int cacheSize{
+        Configuration::getInstance().getSpreadsheetCacheSize()};
+    if (cacheSize == 0)
+        return nullptr;
+
+    const QString filePath{fileInfo_.canonicalFilePath()};
+    SpreadsheetCache cache(DatasetUtilities::getSpreadsheetsCacheDir(),
+                           Constants::megabytesToBytes(cacheSize));
+    const QString key{SpreadsheetCache::computeKey(filePath, sheetName)};
+    if (key.isEmpty() || !cache.contains(key))
+        return nullptr;
+
+    // Converted file is read instead of parsing spreadsheet again.
+    LOG(LogTypes::IMPORT_EXPORT,
+        "Using cached conversion of sheet " + sheetName + " of " + filePath +
+            " from " + cache.getFilePath(key) + ".");
+    cache.markUsed(key);
+    return std::make_unique<DatasetInner>(getDatasetName(sheetName),
+                                          cache.getFilePath(key));
+}
+
 bool SpreadsheetsImportTab::fileIsOk(const QFileInfo& fileInfo)
 {
     return fileInfo.exists() && fileInfo.isReadable();
 }
 
-QString SpreadsheetsImportTab::getValidDatasetName(const QFileInfo& fileInfo)
+QString SpreadsheetsImportTab::getValidDatasetName(const QString& name)
 {
     const QString regexpString{DatasetUtilities::getDatasetNameRegExp().replace(
         QStringLiteral("["), QStringLiteral("[^"))};
-    QString datasetName{
-        fileInfo.completeBaseName().remove(QRegularExpression(regexpString))};
+    QString datasetName{QString(name).remove(QRegularExpression(regexpString))};
 
     if (datasetName.isEmpty())
         datasetName = tr("Dataset");
@@ -105,6 +171,35 @@ QString SpreadsheetsImportTab::getValidDatasetName(const QFileInfo& fileInfo)
     return datasetName;
 }
 
+QString SpreadsheetsImportTab::getDatasetName(const QString& sheetName) const
+{
+    // Sheet is part of name only when file has many sheets.
+    const QString baseName{fileInfo_.completeBaseName()};
+    if (ui_->sheetCombo->count() <= 1)
+        return getValidDatasetName(baseName);
+
+    // Names of sheets differing only in removed characters get numbers, as
+    // analyses and tabs are identified by dataset names.
+    QStringList usedNames;
+    for (int index = 0; index < ui_->sheetCombo->count(); ++index)
+    {
+        const QString sheet{ui_->sheetCombo->itemText(index)};
+        const QString name{getValidDatasetName(baseName + " " + sheet)};
+        QString uniqueName{name};
+        for (int number = 2; usedNames.contains(uniqueName); ++number)
+            uniqueName = name + " " + QString::number(number);
+        if (sheet == sheetName)
+            return uniqueName;
+        usedNames.append(uniqueName);
+    }
+    return getValidDatasetName(baseName + " " + sheetName);
+}
+
+bool SpreadsheetsImportTab::isXlsx() const
+{
+    return fileInfo_.suffix().toLower().compare(QStringLiteral("xlsx")) == 0;
+}
+
 bool SpreadsheetsImportTab::getFileInfo(QFileInfo& fileInfo)
 {
     const QString filePath = QFileDialog::getOpenFileName(
@@ -121,17 +216,194 @@ bool SpreadsheetsImportTab::getFileInfo(QFileInfo& fileInfo)
     return true;
 }
 
+bool SpreadsheetsImportTab::showSampledDataset(
+    std::unique_ptr<DatasetSpreadsheet> dataset)
+{
+    dataset->enableFastAnalysis(FAST_ANALYSIS_ROWS);
+    if (!dataset->initialize())
+    {
+        LOG(LogTypes::IMPORT_EXPORT,
+            "Can not infer columns from first rows of " +
+                dataset->getFilePath() + ", analysing whole sheet.");
+        return false;
+    }
+
+    sampledColumnNames_.clear();
+    sampledColumnTypes_.clear();
+    for (unsigned int column = 0; column < dataset->columnCount(); ++column)
+    {
+        sampledColumnNames_.append(dataset->getHeaderName(column));
+        sampledColumnTypes_.append(dataset->getColumnFormat(column));
+    }
+
+    // Importing is possible once whole sheet is verified.
+    setDataset(std::move(dataset), false);
+    return true;
+}
+
+QStringList SpreadsheetsImportTab::getChangedColumns(
+    const Dataset& dataset) const
+{
+    QStringList changedColumns;
+    const auto columnCount{static_cast<int>(dataset.columnCount())};
+    for (int column = 0; column < columnCount; ++column)
+    {
+        const QString name{dataset.getHeaderName(column)};
+        if (column >= sampledColumnNames_.size() ||
+            sampledColumnNames_[column] != name ||
+            sampledColumnTypes_[column] != dataset.getColumnFormat(column))
+            changedColumns.append(name);
+    }
+
+    for (int column = columnCount; column < sampledColumnNames_.size();
+         ++column)
+        changedColumns.append(sampledColumnNames_[column]);
+
+    return changedColumns;
+}
+
+void SpreadsheetsImportTab::clearSheets()
+{
+    analysisLoader_.cancel();
+    sheetDatasets_.clear();
+    pendingSheets_.clear();
+    waitingSheets_.clear();
+    sharedStrings_.clear();
+    sharedStringsLoaded_ = false;
+    displayedSheet_.clear();
+    fillSheetCombo({});
+}
+
+void SpreadsheetsImportTab::fillSheetCombo(const QStringList& sheetNames)
+{
+    // First sheet is displayed and checked for import.
+    auto* model{qobject_cast<QStandardItemModel*>(ui_->sheetCombo->model())};
+    ui_->sheetCombo->blockSignals(true);
+    model->blockSignals(true);
+    ui_->sheetCombo->clear();
+    ui_->sheetCombo->addItems(sheetNames);
+    for (int row = 0; row < model->rowCount(); ++row)
+    {
+        QStandardItem* item{model->item(row)};
+        item->setFlags(Qt::ItemIsSelectable | Qt::ItemIsEnabled |
+                       Qt::ItemIsUserCheckable);
+        item->setCheckState(row == 0 ? Qt::Checked : Qt::Unchecked);
+    }
+    model->blockSignals(false);
+    ui_->sheetCombo->blockSignals(false);
+    ui_->sheetCombo->setVisible(sheetNames.size() > 1);
+}
+
+QStringList SpreadsheetsImportTab::getCheckedSheets() const
+{
+    const auto* model{
+        qobject_cast<const QStandardItemModel*>(ui_->sheetCombo->model())};
+    QStringList sheetNames;
+    for (int row = 0; row < model->rowCount(); ++row)
+        if (model->item(row)->checkState() == Qt::Checked)
+            sheetNames.append(model->item(row)->text());
+    return sheetNames;
+}
+
+void SpreadsheetsImportTab::showSheet(const QString& sheetName)
+{
+    displayedSheet_ = sheetName;
+
+    const auto it{sheetDatasets_.find(sheetName)};
+    if (it != sheetDatasets_.end())
+    {
+        std::unique_ptr<Dataset> dataset{std::move(it->second)};
+        sheetDatasets_.erase(it);
+        setDataset(std::move(dataset));
+        return;
+    }
+
+    std::unique_ptr<Dataset> dataset{createCachedDataset(sheetName)};
+    if (dataset == nullptr)
+    {
+        if (showSampledDataset(createDataset(sheetName)))
+        {
+            if (!isBeingAnalysed(sheetName))
+                startAnalysis(sheetName);
+            return;
+        }
+        dataset = createDataset(sheetName);
+    }
+
+    analyzeFile(dataset);
+    storeSharedStrings(*dataset);
+    setDataset(std::move(dataset));
+}
+
+void SpreadsheetsImportTab::startAnalysis(const QString& sheetName)
+{
+    std::unique_ptr<Dataset> dataset{createCachedDataset(sheetName)};
+    if (dataset == nullptr)
+    {
+        // Shared strings of .xlsx are parsed by first analysis only.
+        if (isXlsx() && !sharedStringsLoaded_ && !pendingSheets_.isEmpty())
+        {
+            waitingSheets_.append(sheetName);
+            return;
+        }
+        dataset = createDataset(sheetName);
+    }
+
+    pendingSheets_.insert(dataset->getName(), sheetName);
+    analysisLoader_.add(std::move(dataset));
+}
+
+void SpreadsheetsImportTab::startWaitingAnalyses()
+{
+    const QStringList waitingSheets{std::exchange(waitingSheets_, {})};
+    for (const QString& sheetName : waitingSheets)
+        startAnalysis(sheetName);
+}
+
+bool SpreadsheetsImportTab::isBeingAnalysed(const QString& sheetName) const
+{
+    return !pendingSheets_.key(sheetName).isEmpty() ||
+           waitingSheets_.contains(sheetName);
+}
+
+void SpreadsheetsImportTab::storeSharedStrings(const Dataset& dataset)
+{
+    const auto* xlsx{dynamic_cast<const DatasetXlsx*>(&dataset)};
+    if (xlsx == nullptr || sharedStringsLoaded_ || !xlsx->isValid())
+        return;
+
+    sharedStrings_ = xlsx->getSharedStrings();
+    sharedStringsLoaded_ = true;
+}
+
+void SpreadsheetsImportTab::updateReadiness()
+{
+    const QStringList checkedSheets{getCheckedSheets()};
+    bool ready{!checkedSheets.isEmpty()};
+    for (const QString& sheetName : checkedSheets)
+        ready = ready && !isBeingAnalysed(sheetName) &&
+                (sheetName == displayedSheet_ ||
+                 sheetDatasets_.find(sheetName) != sheetDatasets_.end());
+
+    ui_->verificationLabel->setVisible(!pendingSheets_.isEmpty() ||
+                                       !waitingSheets_.isEmpty());
+    Q_EMIT datasetIsReady(ready);
+}
+
 void SpreadsheetsImportTab::openFileButtonClicked()
 {
     QFileInfo fileInfo;
     if (!getFileInfo(fileInfo))
         return;
 
+    clearSheets();
+
     Configuration::getInstance().setImportFilePath(fileInfo.canonicalPath());
     ui_->fileNameLineEdit->setText(fileInfo.filePath());
+    fileInfo_ = fileInfo;
 
-    std::unique_ptr<Dataset> dataset{createDataset(fileInfo)};
-    if (dataset == nullptr)
+    std::unique_ptr<DatasetSpreadsheet> spreadsheet{createDataset({})};
+    if (spreadsheet == nullptr)
     {
         QMessageBox::information(this, tr("Wrong file"),
                                  tr("File type is not supported."));
@@ -139,6 +411,96 @@ void SpreadsheetsImportTab::openFileButtonClicked()
         return;
     }
 
-    analyzeFile(dataset);
+    const auto [success, sheetNames] = spreadsheet->readSheetNames();
+    if (!success)
+    {
+        QMessageBox::information(this, tr("Damaged file"),
+                                 tr("Can not read sheets of file."));
+        Q_EMIT datasetIsReady(false);
+        return;
+    }
+
+    fillSheetCombo(sheetNames);
+    showSheet(sheetNames.constFirst());
+    updateReadiness();
+}
+
+void SpreadsheetsImportTab::currentSheetChanged(int index)
+{
+    const QString sheetName{ui_->sheetCombo->itemText(index)};
+    if (index < 0 || sheetName == displayedSheet_)
+        return;
+
+    // Sheet being analysed is displayed again once analysis ends.
+    std::unique_ptr<Dataset> displayedDataset{getDataset()};
+    if (displayedDataset != nullptr && !isBeingAnalysed(displayedSheet_))
+        sheetDatasets_[displayedSheet_] = std::move(displayedDataset);
+
+    showSheet(sheetName);
+    updateReadiness();
+}
+
+void SpreadsheetsImportTab::sheetCheckChanged(QStandardItem* item)
+{
+    const QString sheetName{item->text()};
+    if (item->checkState() == Qt::Checked && sheetName != displayedSheet_ &&
+        !isBeingAnalysed(sheetName) &&
+        sheetDatasets_.find(sheetName) == sheetDatasets_.end())
+        startAnalysis(sheetName);
+
+    updateReadiness();
+}
+
+void SpreadsheetsImportTab::analysisFinished(const QString& datasetName)
+{
+    const QString sheetName{pendingSheets_.take(datasetName)};
+    std::unique_ptr<Dataset> dataset{analysisLoader_.take(datasetName)};
+    if (dataset != nullptr)
+        storeSharedStrings(*dataset);
+    startWaitingAnalyses();
+
+    if (dataset == nullptr)
+    {
+        // Sheet which can not be analysed is not imported.
+        const int index{ui_->sheetCombo->findText(sheetName)};
+        auto* model{
+            qobject_cast<QStandardItemModel*>(ui_->sheetCombo->model())};
+        if (index != -1)
+            model->item(index)->setCheckState(Qt::Unchecked);
+        QMessageBox::information(
+            this, tr("Damaged file"),
+            tr("Can not analyse whole sheet ") + sheetName + ".");
+    }
+    else if (sheetName == displayedSheet_)
+    {
+        showVerifiedDataset(std::move(dataset));
+    }
+    else
+    {
+        sheetDatasets_[sheetName] = std::move(dataset);
+    }
+
+    updateReadiness();
+}
+
+void SpreadsheetsImportTab::showVerifiedDataset(
+    std::unique_ptr<Dataset> dataset)
+{
+    LOG(LogTypes::IMPORT_EXPORT,
+        "Verified columns of sheet having " +
+            QString::number(dataset->rowCount()) + " rows.");
+
+    const QStringList changedColumns{getChangedColumns(*dataset)};
+    if (changedColumns.isEmpty())
+    {
+        replaceDataset(std::move(dataset));
+        return;
+    }
+
+    // Later rows contradict first ones, verified columns replace inferred.
     setDataset(std::move(dataset));
+    QMessageBox::warning(
+        this, tr("Columns changed"),
+        tr("Types of columns were corrected after analysing whole sheet: ") +
+            changedColumns.join(QStringLiteral(", ")) + ".");
 }
@@ -1,16 +1,25 @@
 #pragma once
 
+#include <map>
 #include <memory>
 
+#include <ColumnType.h>
+#include <QFileInfo>
+#include <QMap>
+
+#include <Datasets/StringsTable.h>
+
+#include "DatasetPreviewLoader.h"
 #include "ImportTab.h"
 
 #include "ui_SpreadsheetsImportTab.h"
 
 class DatasetSpreadsheet;
-class QFileInfo;
+class QStandardItem;
 
 /**
- * @brief Ui class for importing spreadsheets.
+ * @brief Ui class for importing spreadsheets. Many sheets of file can be
+ * checked for import, each is analysed on worker thread.
  */
 class SpreadsheetsImportTab : public ImportTab
 {
@@ -18,19 +27,88 @@ class SpreadsheetsImportTab : public ImportTab
 public:
     explicit SpreadsheetsImportTab(QWidget* parent = nullptr);
 
+    std::vector<std::unique_ptr<Dataset>> getDatasets() override;
+
 private:
     static void analyzeFile(std::unique_ptr<Dataset>& dataset);
 
-    static std::unique_ptr<Dataset> createDataset(const QFileInfo& fileInfo);
+    std::unique_ptr<DatasetSpreadsheet> createDataset(
+        const QString& sheetName) const;
+
+    std::unique_ptr<Dataset> createCachedDataset(
+        const QString& sheetName) const;
 
     static bool fileIsOk(const QFileInfo& fileInfo);
 
-    static QString getValidDatasetName(const QFileInfo& fileInfo);
+    static QString getValidDatasetName(const QString& name);
+
+    QString getDatasetName(const QString& sheetName) const;
+
+    bool isXlsx() const;
 
     bool getFileInfo(QFileInfo& fileInfo);
 
+    void clearSheets();
+
+    void fillSheetCombo(const QStringList& sheetNames);
+
+    QStringList getCheckedSheets() const;
+
+    void showSheet(const QString& sheetName);
+
+    bool showSampledDataset(std::unique_ptr<DatasetSpreadsheet> dataset);
+
+    void showVerifiedDataset(std::unique_ptr<Dataset> dataset);
+
+    QStringList getChangedColumns(const Dataset& dataset) const;
+
+    void startAnalysis(const QString& sheetName);
+
+    void startWaitingAnalyses();
+
+    bool isBeingAnalysed(const QString& sheetName) const;
+
+    void storeSharedStrings(const Dataset& dataset);
+
+    void updateReadiness();
+
     std::unique_ptr<Ui::SpreadsheetsImportTab> ui_;
 
+    /// Analyzes whole sheets, displayed one after preview built from first
+    /// rows is shown and other checked ones.
+    DatasetPreviewLoader analysisLoader_;
+
+    QFileInfo fileInfo_;
+
+    QString displayedSheet_;
+
+    /// Analysed sheets which are not displayed, with choices made by user.
+    std::map<QString, std::unique_ptr<Dataset>> sheetDatasets_;
+
+    /// Sheets analysed on worker threads, by names of datasets.
+    QMap<QString, QString> pendingSheets_;
+
+    /// Sheets of .xlsx waiting for shared strings parsed by first analysis.
+    QStringList waitingSheets_;
+
+    /// Shared strings of .xlsx file, parsed once for all sheets.
+    StringsTable sharedStrings_;
+
+    bool sharedStringsLoaded_{false};
+
+    /// Columns inferred from first rows, compared with verified ones.
+    QStringList sampledColumnNames_;
+    QVector<ColumnType> sampledColumnTypes_;
+
+    /// Number of rows used to infer columns before whole sheet is analyzed.
+    static constexpr unsigned int FAST_ANALYSIS_ROWS{1'000};
+
 private Q_SLOTS:
     void openFileButtonClicked();
+
+    void currentSheetChanged(int index);
+
+    void sheetCheckChanged(QStandardItem* item);
+
+    void analysisFinished(const QString& datasetName);
 };
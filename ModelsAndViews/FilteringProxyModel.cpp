@@ -18,6 +18,10 @@ void FilteringProxyModel::setStringFilter(int column,
                                           const QStringList& bannedStrings)
 {
     stringsRestrictions_[column] = bannedStrings;
+    if (const TableModel* parentModel{getParentModel()}; parentModel != nullptr)
+        bannedStringCodes_[column] = {
+            parentModel->getStringCodes(column, bannedStrings),
+            bannedStrings.contains(QString())};
     invalidate();
 }
 
@@ -34,9 +38,46 @@ void FilteringProxyModel::setNumericFilter(int column, double from, double to)
     invalidate();
 }
 
+quint64 FilteringProxyModel::getMappingMemoryUsage() const
+{
+    if (sourceModel() == nullptr)
+        return 0;
+
+    // Qt keeps mapping from proxy to source and from source to proxy for
+    // both rows and columns.
+    const auto mappedItems{static_cast<quint64>(
+        rowCount() + sourceModel()->rowCount() + columnCount() +
+        sourceModel()->columnCount())};
+    quint64 memoryUsage{mappedItems * sizeof(int)};
+
+    const quint64 bitsInByte{8};
+    for (const auto& [column, restriction] : bannedStringCodes_)
+        memoryUsage += (static_cast<quint64>(restriction.first.size()) +
+                        bitsInByte - 1) /
+                       bitsInByte;
+    return memoryUsage;
+}
+
+bool FilteringProxyModel::acceptRowAccordingToStringCodes(
+    int sourceRow) const
+{
+    const TableModel* parentModel{getParentModel()};
+    for (const auto& [column, restriction] : bannedStringCodes_)
+    {
+        const auto& [bannedCodes, emptyBanned] = restriction;
+        const int code{parentModel->getStringCode(sourceRow, column)};
+        if (code == -1 ? emptyBanned : bannedCodes.testBit(code))
+            return false;
+    }
+    return true;
+}
+
 bool FilteringProxyModel::acceptRowAccordingToStringRestrictions(
     int sourceRow, const QModelIndex& sourceParent) const
 {
+    if (getParentModel() != nullptr)
+        return acceptRowAccordingToStringCodes(sourceRow);
+
     for (const auto& [column, bannedStrings] : stringsRestrictions_)
     {
         const QModelIndex index{
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <QBitArray>
 #include <QSortFilterProxyModel>
 
 class TableModel;
@@ -42,6 +43,12 @@ public:
      */
     void setNumericFilter(int column, double from, double to);
 
+    /**
+     * @brief estimate memory used by row mappings and filters.
+     * @return number of bytes.
+     */
+    quint64 getMappingMemoryUsage() const;
+
 protected:
     /**
      * @brief Determine if row should be shown or not.
@@ -62,9 +69,14 @@ private:
     bool acceptRowAccordingToNumericRestrictions(
         int sourceRow, const QModelIndex& sourceParent) const;
 
+    bool acceptRowAccordingToStringCodes(int sourceRow) const;
+
     /// Filter set for strings.
     std::map<int, QStringList> stringsRestrictions_;
 
+    /// Filter set for strings as dictionary codes and flag for empty strings.
+    std::map<int, std::pair<QBitArray, bool> > bannedStringCodes_;
+
     /// Filter set for dates.
     std::map<int, std::tuple<QDate, QDate, bool> > datesRestrictions_;
 
@@ -20,7 +20,7 @@ int TableModel::columnCount([[maybe_unused]] const QModelIndex& parent) const
 QVariant TableModel::data(const QModelIndex& index, int role) const
 {
     if (role == Qt::DisplayRole)
-        return *dataset_->getData(index.row(), index.column());
+        return dataset_->getData(index.row(), index.column());
     return {};
 }
 
@@ -47,6 +47,42 @@ QStringList TableModel::getStringList(int column) const
     return dataset_->getStringList(column);
 }
 
+const ColumnStatistics& TableModel::getColumnStatistics(int column) const
+{
+    return dataset_->getColumnStatistics(column);
+}
+
+MemoryUsage TableModel::getColumnMemoryUsage(int column) const
+{
+    return dataset_->getColumnMemoryUsage(column);
+}
+
+QString TableModel::getColumnEncodingName(int column) const
+{
+    return dataset_->getColumnEncodingName(column);
+}
+
+std::shared_ptr<const DatasetSnapshot> TableModel::getSnapshot() const
+{
+    return dataset_->getSnapshot();
+}
+
+MemoryUsage TableModel::getMemoryUsage() const
+{
+    return dataset_->getMemoryUsage();
+}
+
+int TableModel::getStringCode(int row, int column) const
+{
+    return dataset_->getStringCode(row, column);
+}
+
+QBitArray TableModel::getStringCodes(int column,
+                                     const QStringList& strings) const
+{
+    return dataset_->getStringCodes(column, strings);
+}
+
 ColumnType TableModel::getColumnFormat(int column) const
 {
     return dataset_->getColumnFormat(column);
@@ -58,9 +94,11 @@ std::tuple<bool, int> TableModel::getTaggedColumnIfExists(
     return dataset_->getTaggedColumn(columnTag);
 }
 
-QByteArray TableModel::definitionToXml(unsigned int rowCount) const
+QByteArray TableModel::definitionToXml(unsigned int rowCount,
+                                       DatasetFormat format,
+                                       unsigned int blockRows) const
 {
-    return dataset_->definitionToXml(rowCount);
+    return dataset_->definitionToXml(rowCount, format, blockRows);
 }
 
 bool TableModel::areTaggedColumnsSet() const
@@ -71,6 +71,55 @@ public:
      */
     QStringList getStringList(int column) const;
 
+    /**
+     * @brief get statistics of column cached during loading of dataset.
+     * @param column Column number.
+     * @return Column statistics.
+     */
+    const ColumnStatistics& getColumnStatistics(int column) const;
+
+    /**
+     * @brief get memory used by given column of dataset.
+     * @param column Column number.
+     * @return Memory usage.
+     */
+    MemoryUsage getColumnMemoryUsage(int column) const;
+
+    /**
+     * @brief get name of encoding used for values of given column.
+     * @param column Column number.
+     * @return Encoding name.
+     */
+    QString getColumnEncodingName(int column) const;
+
+    /**
+     * @brief get immutable snapshot of data for reading in worker threads.
+     * @return Snapshot of dataset columns.
+     */
+    std::shared_ptr<const DatasetSnapshot> getSnapshot() const;
+
+    /**
+     * @brief get memory used by dataset.
+     * @return Memory usage.
+     */
+    MemoryUsage getMemoryUsage() const;
+
+    /**
+     * @brief get dictionary code of string in given cell.
+     * @param row Row number.
+     * @param column Column number.
+     * @return Code or -1 for empty cell.
+     */
+    int getStringCode(int row, int column) const;
+
+    /**
+     * @brief get dictionary codes of given strings in column.
+     * @param column Column number.
+     * @param strings Strings to find.
+     * @return Bit array with bits set for codes of found strings.
+     */
+    QBitArray getStringCodes(int column, const QStringList& strings) const;
+
     /**
      * @brief get type of given column.
      * @return data format of given column.
@@ -88,7 +137,9 @@ public:
      * @brief get dataset used in model.
      * @return dataset definition pointer.
      */
-    QByteArray definitionToXml(unsigned int rowCount) const;
+    QByteArray definitionToXml(
+        unsigned int rowCount, DatasetFormat format = DatasetFormat::TEXT,
+        unsigned int blockRows = COLUMNAR_BLOCK_ROWS) const;
 
     bool areTaggedColumnsSet() const;
 
@@ -13,5 +13,6 @@ enum class LogTypes : char
     LOGIN,
     APP,
     IMPORT_EXPORT,
+    MEMORY,
     END
 };
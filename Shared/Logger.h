@@ -63,7 +63,8 @@ private:
         {LogTypes::NETWORK, "NETWORK"},
         {LogTypes::LOGIN, "LOGIN"},
         {LogTypes::APP, "APPLICATION"},
-        {LogTypes::IMPORT_EXPORT, "IMPORT_EXPORT"}};
+        {LogTypes::IMPORT_EXPORT, "IMPORT_EXPORT"},
+        {LogTypes::MEMORY, "MEMORY"}};
 
     const QString timeStyleBegin_{
         QStringLiteral("<b><font size=\"3\" color=\"blue\">")};
@@ -0,0 +1,80 @@
+#include "DataBlockQueueTest.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <QtTest/QtTest>
+
+#include <Datasets/DataBlockQueue.h>
+
+void DataBlockQueueTest::testOrderOfBlocks()
+{
+    DataBlockQueue queue(3);
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        DataBlock block{QByteArray::number(i), i};
+        QVERIFY(queue.tryPush(block, 0));
+    }
+
+    DataBlock block;
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        QVERIFY(queue.pop(block));
+        QCOMPARE(block.firstRow_, i);
+        QCOMPARE(block.bytes_, QByteArray::number(i));
+    }
+}
+
+void DataBlockQueueTest::testPushTimeoutWhenFull()
+{
+    DataBlockQueue queue(1);
+    DataBlock first{"a", 0};
+    QVERIFY(queue.tryPush(first, 0));
+    DataBlock second{"b", 1};
+    QVERIFY(!queue.tryPush(second, 10));
+    QCOMPARE(second.bytes_, QByteArray("b"));
+}
+
+void DataBlockQueueTest::testPopAfterClose()
+{
+    DataBlockQueue queue(2);
+    DataBlock block{"a", 0};
+    QVERIFY(queue.tryPush(block, 0));
+    queue.close();
+
+    QVERIFY(queue.pop(block));
+    QCOMPARE(block.bytes_, QByteArray("a"));
+    QVERIFY(!queue.pop(block));
+}
+
+void DataBlockQueueTest::testProducerAndConsumers()
+{
+    DataBlockQueue queue(2);
+    std::atomic<unsigned int> sum{0};
+    std::vector<std::unique_ptr<QThread>> consumers;
+    for (int i = 0; i < 4; ++i)
+    {
+        consumers.emplace_back(QThread::create(
+            [&queue, &sum]()
+            {
+                DataBlock block;
+                while (queue.pop(block))
+                    sum += block.firstRow_;
+            }));
+        consumers.back()->start();
+    }
+
+    const unsigned int blocksCount{1000};
+    for (unsigned int i = 1; i <= blocksCount; ++i)
+    {
+        DataBlock block{{}, i};
+        while (!queue.tryPush(block, 10))
+            QThread::yieldCurrentThread();
+    }
+    queue.close();
+    for (const auto& consumer : consumers)
+        QVERIFY(consumer->wait());
+
+    QCOMPARE(sum.load(), blocksCount * (blocksCount + 1) / 2);
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <QObject>
+
+/**
+ * @brief Tests for DataBlockQueue class.
+ */
+class DataBlockQueueTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    static void testOrderOfBlocks();
+
+    static void testPushTimeoutWhenFull();
+
+    static void testPopAfterClose();
+
+    static void testProducerAndConsumers();
+};
@@ -0,0 +1,387 @@
+#include "DataColumnTest.h"
+
+#include <cmath>
+
+#include <QtTest/QtTest>
+
+#include <Common/DatasetUtilities.h>
+#include <Datasets/DataColumn.h>
+#include <Datasets/Dataset.h>
+
+#include "DatasetCommon.h"
+
+void DataColumnTest::testNumbers()
+{
+    DataColumn column(ColumnType::NUMBER, 3);
+    column.setNumber(0, 1.5);
+    column.setNumber(2, -3.);
+
+    QCOMPARE(column.rowCount(), 3);
+    QCOMPARE(column.getColumnType(), ColumnType::NUMBER);
+    QCOMPARE(column.getNumber(0), 1.5);
+    QCOMPARE(column.getNumber(2), -3.);
+    QVERIFY(!column.isNull(0));
+    QVERIFY(column.isNull(1));
+}
+
+void DataColumnTest::testDates()
+{
+    const QDate date(2020, 4, 20);
+    DataColumn column(ColumnType::DATE, 2);
+    column.setJulianDay(1, static_cast<int>(date.toJulianDay()));
+
+    QVERIFY(column.isNull(0));
+    QVERIFY(!column.isNull(1));
+    QCOMPARE(QDate::fromJulianDay(column.getJulianDay(1)), date);
+}
+
+void DataColumnTest::testStrings()
+{
+    DataColumn column(ColumnType::STRING, 4);
+    column.setString(0, QStringLiteral("b"));
+    column.setString(1, QStringLiteral("a"));
+    column.setString(3, QStringLiteral("b"));
+
+    QCOMPARE(column.getString(0), QStringLiteral("b"));
+    QCOMPARE(column.getString(1), QStringLiteral("a"));
+    QCOMPARE(column.getStringCode(0), column.getStringCode(3));
+    QVERIFY(column.isNull(2));
+    const QStringList expectedDictionary{QStringLiteral("b"),
+                                         QStringLiteral("a")};
+    QCOMPARE(column.getDictionary(), expectedDictionary);
+}
+
+void DataColumnTest::testStringCodeWidth()
+{
+    const int rowCount{70'000};
+    DataColumn column(ColumnType::STRING, rowCount);
+    column.setString(0, QStringLiteral("first"));
+    QCOMPARE(column.getCodeWidth(), 1);
+
+    for (int row = 1; row < 300; ++row)
+        column.setString(row, QString::number(row));
+    QCOMPARE(column.getCodeWidth(), 2);
+
+    for (int row = 300; row < rowCount; ++row)
+        column.setString(row, QString::number(row));
+    QCOMPARE(column.getCodeWidth(), 4);
+
+    QCOMPARE(column.getString(0), QStringLiteral("first"));
+    QCOMPARE(column.getString(299), QStringLiteral("299"));
+    QCOMPARE(column.getString(rowCount - 1), QString::number(rowCount - 1));
+}
+
+void DataColumnTest::testNulls()
+{
+    DataColumn column(ColumnType::NUMBER, 1);
+    column.setNumber(0, 2.);
+    QVERIFY(!column.isNull(0));
+
+    column.setNull(0);
+    QVERIFY(column.isNull(0));
+    QCOMPARE(column.getNumber(0), 0.);
+}
+
+void DataColumnTest::testSetWholeColumn()
+{
+    QBitArray validity(3, true);
+    validity.clearBit(1);
+
+    DataColumn numbers(ColumnType::NUMBER, 3);
+    numbers.setNumbers({2.5, 0., -1.}, validity);
+    numbers.finishFilling();
+    QVERIFY(numbers.isNull(1));
+    QCOMPARE(numbers.getNumber(2), -1.);
+    QCOMPARE(numbers.getStatistics().minNumber_, -1.);
+    QCOMPARE(numbers.getStatistics().maxNumber_, 2.5);
+
+    const int julianDay{2'451'545};
+    DataColumn dates(ColumnType::DATE, 3);
+    dates.setJulianDays({julianDay, 0, julianDay + 2}, validity);
+    dates.finishFilling();
+    QCOMPARE(dates.getJulianDay(2), julianDay + 2);
+    QCOMPARE(dates.getStatistics().minDate_, QDate::fromJulianDay(julianDay));
+
+    QStringList dictionary;
+    QVector<quint32> codes;
+    for (int i = 0; i < 300; ++i)
+    {
+        dictionary << QString::number(i);
+        codes << static_cast<quint32>(299 - i);
+    }
+    DataColumn strings(ColumnType::STRING, 300);
+    strings.setStrings(dictionary, codes.constData(), QBitArray(300, true));
+    QCOMPARE(strings.getCodeWidth(), 2);
+    QCOMPARE(strings.getString(0), QStringLiteral("299"));
+    QCOMPARE(strings.getString(299), QStringLiteral("0"));
+}
+
+void DataColumnTest::testStatistics()
+{
+    DataColumn numbers(ColumnType::NUMBER, 4);
+    numbers.setNumber(0, 3.);
+    numbers.setNumber(1, -1.);
+    numbers.setNumber(3, 3.);
+    numbers.finishFilling();
+    QCOMPARE(numbers.getStatistics().minNumber_, -1.);
+    QCOMPARE(numbers.getStatistics().maxNumber_, 3.);
+    QCOMPARE(numbers.getStatistics().nullCount_, 1U);
+    QCOMPARE(numbers.getStatistics().distinctCount_, 2U);
+
+    const QDate date(2020, 4, 20);
+    DataColumn dates(ColumnType::DATE, 2);
+    dates.setJulianDay(0, static_cast<int>(date.toJulianDay()));
+    dates.setJulianDay(1, static_cast<int>(date.addDays(-1).toJulianDay()));
+    dates.finishFilling();
+    QCOMPARE(dates.getStatistics().minDate_, date.addDays(-1));
+    QCOMPARE(dates.getStatistics().maxDate_, date);
+    QCOMPARE(dates.getStatistics().nullCount_, 0U);
+    QCOMPARE(dates.getStatistics().distinctCount_, 2U);
+
+    DataColumn constants(ColumnType::NUMBER, 3);
+    constants.setNumber(0, 5.);
+    constants.setNumber(2, 5.);
+    constants.finishFilling();
+    QCOMPARE(constants.getStatistics().distinctCount_, 1U);
+
+    DataColumn strings(ColumnType::STRING, 3);
+    strings.setString(0, QStringLiteral("b"));
+    strings.setString(2, QStringLiteral("a"));
+    strings.finishFilling();
+    const QStringList expectedStrings{QStringLiteral("a"),
+                                      QStringLiteral("b")};
+    QCOMPARE(strings.getStatistics().sortedStrings_, expectedStrings);
+    QCOMPARE(strings.getStatistics().distinctCount_, 2U);
+    QCOMPARE(strings.getStatistics().nullCount_, 1U);
+}
+
+void DataColumnTest::testCachedStatistics()
+{
+    DataColumn strings(ColumnType::STRING, 3);
+    strings.setString(0, QStringLiteral("c"));
+    strings.setString(1, QStringLiteral("a"));
+    strings.setString(2, QStringLiteral("b"));
+    const QVector<quint32> sortedCodes{1, 2, 0};
+    QVERIFY(strings.finishFilling(3, sortedCodes));
+    const QStringList expectedStrings{
+        QStringLiteral("a"), QStringLiteral("b"), QStringLiteral("c")};
+    QCOMPARE(strings.getStatistics().sortedStrings_, expectedStrings);
+    QCOMPARE(strings.getSortedCodes(), sortedCodes);
+
+    // Codes not fitting dictionary are ignored and statistics computed.
+    DataColumn otherStrings(ColumnType::STRING, 2);
+    otherStrings.setString(0, QStringLiteral("b"));
+    otherStrings.setString(1, QStringLiteral("a"));
+    QVERIFY(!otherStrings.finishFilling(2, {0, 0}));
+    const QStringList expectedOtherStrings{QStringLiteral("a"),
+                                           QStringLiteral("b")};
+    QCOMPARE(otherStrings.getStatistics().sortedStrings_,
+             expectedOtherStrings);
+    QCOMPARE(otherStrings.getStatistics().distinctCount_, 2U);
+
+    DataColumn numbers(ColumnType::NUMBER, 2);
+    numbers.setNumber(0, 1.);
+    numbers.setNumber(1, 2.);
+    QVERIFY(numbers.finishFilling(2, {}));
+    QCOMPARE(numbers.getStatistics().distinctCount_, 2U);
+    QCOMPARE(numbers.getStatistics().maxNumber_, 2.);
+}
+
+void DataColumnTest::testSpill()
+{
+    const int rowCount{1000};
+    DataColumn numbers(ColumnType::NUMBER, rowCount);
+    DataColumn strings(ColumnType::STRING, rowCount);
+    for (int row = 1; row < rowCount; ++row)
+    {
+        numbers.setNumber(row, row + 1. / 3.);
+        strings.setString(row, QString::number(row % 300));
+    }
+    numbers.finishFilling();
+    strings.finishFilling();
+    const quint64 numbersMemory{numbers.getValuesMemoryUsage()};
+
+    QCOMPARE(numbers.getEncoding(), DataColumn::Encoding::PLAIN);
+    QVERIFY(numbers.spill(QDir::tempPath() + "/"));
+    QVERIFY(strings.spill(QDir::tempPath() + "/"));
+    QVERIFY(numbers.isSpilled());
+    QCOMPARE(numbers.getSpilledSize(),
+             static_cast<quint64>(rowCount) * sizeof(double));
+    QVERIFY(numbers.getValuesMemoryUsage() < numbersMemory);
+
+    const DataColumn numbersCopy{numbers};
+    QVERIFY(numbers.isNull(0));
+    QCOMPARE(numbers.getNumber(rowCount - 1), rowCount - 1 + 1. / 3.);
+    QCOMPARE(numbersCopy.getNumber(2), 2 + 1. / 3.);
+    QCOMPARE(strings.getCodeWidth(), 2);
+    QCOMPARE(strings.getString(299), QStringLiteral("299"));
+    QCOMPARE(strings.getString(rowCount - 1),
+             QString::number((rowCount - 1) % 300));
+}
+
+void DataColumnTest::testFillSpilled()
+{
+    const int rowCount{1000};
+    const QString directory{QDir::tempPath() + "/"};
+    DataColumn numbers(ColumnType::NUMBER, rowCount, directory);
+    DataColumn dates(ColumnType::DATE, rowCount, directory);
+    DataColumn strings(ColumnType::STRING, rowCount, directory);
+    QVERIFY(numbers.isSpilled());
+    QVERIFY(dates.isSpilled());
+    QVERIFY(strings.isSpilled());
+    QCOMPARE(strings.getCodeWidth(), 4);
+
+    const int firstJulianDay{2'451'545};
+    auto* julianDays{
+        reinterpret_cast<qint32*>(dates.getValuesForFilling())};
+    QBitArray validity(rowCount, true);
+    validity.clearBit(0);
+    for (int row = 1; row < rowCount; ++row)
+    {
+        numbers.setNumber(row, row / 100.);
+        julianDays[row] = firstJulianDay + row;
+        strings.setString(row, QString::number(row % 3));
+    }
+    dates.setValidity(validity);
+    numbers.finishFilling();
+    dates.finishFilling();
+    strings.finishFilling();
+
+    // Values never left file, so they were not encoded.
+    QCOMPARE(numbers.getEncoding(), DataColumn::Encoding::PLAIN);
+    QCOMPARE(dates.getEncoding(), DataColumn::Encoding::PLAIN);
+    QCOMPARE(numbers.getSpilledSize(),
+             static_cast<quint64>(rowCount) * sizeof(double));
+    const quint64 validityBytes{(rowCount + 7) / 8};
+    QCOMPARE(numbers.getValuesMemoryUsage(), validityBytes);
+
+    QVERIFY(numbers.isNull(0));
+    QCOMPARE(numbers.getNumber(rowCount - 1), (rowCount - 1) / 100.);
+    QVERIFY(dates.isNull(0));
+    QCOMPARE(dates.getJulianDay(2), firstJulianDay + 2);
+    QCOMPARE(dates.getStatistics().minDate_,
+             QDate::fromJulianDay(firstJulianDay + 1));
+    QVERIFY(strings.isNull(0));
+    QCOMPARE(strings.getString(5), QStringLiteral("2"));
+}
+
+void DataColumnTest::testEncodings()
+{
+    const int rowCount{1000};
+    DataColumn prices(ColumnType::NUMBER, rowCount);
+    DataColumn powers(ColumnType::NUMBER, rowCount);
+    DataColumn fractions(ColumnType::NUMBER, rowCount);
+    DataColumn constant(ColumnType::NUMBER, rowCount);
+    DataColumn dates(ColumnType::DATE, rowCount);
+    DataColumn sortedDates(ColumnType::DATE, rowCount);
+    DataColumn repeatedDates(ColumnType::DATE, rowCount);
+    const int firstJulianDay{2'451'545};
+    for (int row = 0; row < rowCount; ++row)
+    {
+        prices.setNumber(row, row / 100.);
+        powers.setNumber(row, std::ldexp(row, 40));
+        fractions.setNumber(row, row + 1. / 3.);
+        constant.setNumber(row, 7.);
+        dates.setJulianDay(row, firstJulianDay + (row * 37) % 1000);
+        sortedDates.setJulianDay(row, firstJulianDay + row / 10);
+        repeatedDates.setJulianDay(row, firstJulianDay + row / 100);
+    }
+    prices.setNull(1);
+    dates.setNull(2);
+
+    for (DataColumn* column : {&prices, &powers, &fractions, &constant,
+                               &dates, &sortedDates, &repeatedDates})
+        column->finishFilling();
+
+    QCOMPARE(prices.getEncoding(), DataColumn::Encoding::SCALED_INTEGER);
+    QCOMPARE(powers.getEncoding(), DataColumn::Encoding::FLOAT32);
+    QCOMPARE(fractions.getEncoding(), DataColumn::Encoding::PLAIN);
+    QCOMPARE(constant.getEncoding(), DataColumn::Encoding::RUN_LENGTH);
+    QCOMPARE(dates.getEncoding(), DataColumn::Encoding::FRAME_OF_REFERENCE);
+    QCOMPARE(sortedDates.getEncoding(),
+             DataColumn::Encoding::FRAME_OF_REFERENCE);
+    QCOMPARE(repeatedDates.getEncoding(), DataColumn::Encoding::RUN_LENGTH);
+
+    for (int row = 0; row < rowCount; ++row)
+    {
+        QCOMPARE(prices.getNumber(row), row == 1 ? 0. : row / 100.);
+        QCOMPARE(powers.getNumber(row), std::ldexp(row, 40));
+        QCOMPARE(fractions.getNumber(row), row + 1. / 3.);
+        QCOMPARE(constant.getNumber(row), 7.);
+        QCOMPARE(dates.getJulianDay(row),
+                 row == 2 ? 0 : firstJulianDay + (row * 37) % 1000);
+        QCOMPARE(sortedDates.getJulianDay(row), firstJulianDay + row / 10);
+        QCOMPARE(repeatedDates.getJulianDay(row),
+                 firstJulianDay + row / 100);
+    }
+    QVERIFY(prices.isNull(1));
+    QVERIFY(dates.isNull(2));
+    QVERIFY(constant.getValuesMemoryUsage() < fractions.getValuesMemoryUsage());
+}
+
+void DataColumnTest::testMemoryComparedToVariants()
+{
+    const int rowCount{100'000};
+    DataColumn numbers(ColumnType::NUMBER, rowCount);
+    DataColumn dates(ColumnType::DATE, rowCount);
+    DataColumn strings(ColumnType::STRING, rowCount);
+    const QStringList districts{QStringLiteral("north"),
+                               QStringLiteral("south"),
+                               QStringLiteral("east"), QStringLiteral("west")};
+    for (int row = 0; row < rowCount; ++row)
+    {
+        numbers.setNumber(row, row * 0.01);
+        dates.setJulianDay(row, row);
+        strings.setString(row, districts[row % districts.size()]);
+    }
+    strings.finishFilling();
+
+    const quint64 variantsMemory{static_cast<quint64>(rowCount) *
+                                 sizeof(QVariant)};
+    QVERIFY(numbers.getMemoryUsage() * 3 < variantsMemory);
+    QVERIFY(dates.getMemoryUsage() * 6 < variantsMemory);
+    QCOMPARE(strings.getCodeWidth(), 1);
+    QVERIFY(strings.getMemoryUsage() * 20 < variantsMemory);
+}
+
+void DataColumnTest::testLoadedDataMemoryComparedToVariants()
+{
+    std::unique_ptr<Dataset> dataset{DatasetCommon::createDataset(
+        QStringLiteral("ExampleData"), DatasetUtilities::getDatasetsDir())};
+    QVERIFY(dataset->initialize());
+    DatasetCommon::activateAllDatasetColumns(*dataset);
+    QVERIFY(dataset->loadData());
+
+    // Lower bound of memory needed when each row was QVector of QVariants.
+    const quint64 rowsOfVariantsMemory{
+        dataset->rowCount() *
+        (sizeof(QVector<QVariant>) + dataset->columnCount() * sizeof(QVariant))};
+    QVERIFY(dataset->getMemoryUsage().total() * 2 < rowsOfVariantsMemory);
+}
+
+void DataColumnTest::testDatasetMemoryUsageReport()
+{
+    std::unique_ptr<Dataset> dataset{DatasetCommon::createDataset(
+        QStringLiteral("ExampleData"), DatasetUtilities::getDatasetsDir())};
+    QVERIFY(dataset->initialize());
+    DatasetCommon::activateAllDatasetColumns(*dataset);
+    QVERIFY(dataset->loadData());
+
+    MemoryUsage columnsMemory;
+    for (Column column = 0;
+         column < static_cast<Column>(dataset->columnCount()); ++column)
+    {
+        const MemoryUsage columnMemory{dataset->getColumnMemoryUsage(column)};
+        QVERIFY(columnMemory.values_ > 0);
+        QCOMPARE(columnMemory.dictionaries_ > 0,
+                 dataset->getColumnFormat(column) == ColumnType::STRING);
+        columnsMemory += columnMemory;
+    }
+
+    const MemoryUsage memoryUsage{dataset->getMemoryUsage()};
+    QCOMPARE(memoryUsage.values_, columnsMemory.values_);
+    QCOMPARE(memoryUsage.dictionaries_, columnsMemory.dictionaries_);
+    QCOMPARE(memoryUsage.sharedStrings_, 0ULL);
+    QCOMPARE(memoryUsage.total(),
+             memoryUsage.values_ + memoryUsage.dictionaries_);
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <QObject>
+
+/**
+ * @brief Tests for DataColumn class.
+ */
+class DataColumnTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    static void testNumbers();
+
+    static void testDates();
+
+    static void testStrings();
+
+    static void testStringCodeWidth();
+
+    static void testNulls();
+
+    static void testSetWholeColumn();
+
+    static void testStatistics();
+
+    static void testCachedStatistics();
+
+    static void testSpill();
+
+    static void testFillSpilled();
+
+    static void testEncodings();
+
+    static void testMemoryComparedToVariants();
+
+    static void testLoadedDataMemoryComparedToVariants();
+
+    static void testDatasetMemoryUsageReport();
+};
@@ -0,0 +1,81 @@
+#include "DatasetCatalogTest.h"
+
+#include <QFile>
+#include <QtTest/QtTest>
+
+#include <Common/DatasetUtilities.h>
+#include <Datasets/DatasetCatalog.h>
+
+namespace
+{
+const DatasetCatalog::Entry* findEntry(const DatasetCatalog& catalog,
+                                       const QString& name)
+{
+    for (const auto& entry : catalog.getEntries())
+        if (entry.name_ == name)
+            return &entry;
+    return nullptr;
+}
+}  // namespace
+
+void DatasetCatalogTest::testEntries()
+{
+    DatasetCatalog catalog;
+    QVERIFY(catalog.refresh());
+    QVERIFY(QFile::exists(DatasetUtilities::getDatasetsDir() +
+                          DatasetUtilities::getDatasetsCatalogFilename()));
+    QCOMPARE(catalog.getEntries().size(),
+             DatasetUtilities::getListOfAvailableDatasets().size());
+
+    const DatasetCatalog::Entry* entry{
+        findEntry(catalog, QStringLiteral("ExampleData"))};
+    QVERIFY(entry != nullptr);
+    QCOMPARE(entry->rowCount_, 55U);
+    const QVector<ColumnType> expectedTypes{
+        ColumnType::STRING, ColumnType::NUMBER, ColumnType::DATE,
+        ColumnType::NUMBER, ColumnType::NUMBER, ColumnType::NUMBER,
+        ColumnType::STRING};
+    QCOMPARE(entry->columnTypes_, expectedTypes);
+    QCOMPARE(entry->taggedColumns_.value(ColumnTag::DATE), 2);
+    QCOMPARE(entry->taggedColumns_.value(ColumnTag::VALUE), 5);
+    QVERIFY(entry->size_ > 0);
+}
+
+void DatasetCatalogTest::testReloadedEntries()
+{
+    DatasetCatalog catalog;
+    QVERIFY(catalog.refresh());
+    DatasetCatalog reloadedCatalog;
+    QVERIFY(reloadedCatalog.refresh());
+
+    QCOMPARE(reloadedCatalog.getEntries().size(), catalog.getEntries().size());
+    for (const auto& entry : catalog.getEntries())
+    {
+        const DatasetCatalog::Entry* reloaded{
+            findEntry(reloadedCatalog, entry.name_)};
+        QVERIFY(reloaded != nullptr);
+        QCOMPARE(reloaded->rowCount_, entry.rowCount_);
+        QCOMPARE(reloaded->columnTypes_, entry.columnTypes_);
+        QCOMPARE(reloaded->size_, entry.size_);
+        QCOMPARE(reloaded->lastModified_, entry.lastModified_);
+        QCOMPARE(reloaded->taggedColumns_, entry.taggedColumns_);
+    }
+}
+
+void DatasetCatalogTest::testAddedAndRemovedDataset()
+{
+    const QString name{QStringLiteral("ExampleData_catalog")};
+    QVERIFY(QFile::copy(DatasetUtilities::getDatasetsDir() + "ExampleData" +
+                            DatasetUtilities::getDatasetExtension(),
+                        DatasetUtilities::getDatasetsDir() + name +
+                            DatasetUtilities::getDatasetExtension()));
+    DatasetCatalog catalog;
+    QVERIFY(catalog.refresh());
+    const DatasetCatalog::Entry* entry{findEntry(catalog, name)};
+    QVERIFY(entry != nullptr);
+    QCOMPARE(entry->rowCount_, 55U);
+
+    QVERIFY(DatasetUtilities::removeDataset(name));
+    QVERIFY(catalog.refresh());
+    QVERIFY(findEntry(catalog, name) == nullptr);
+}
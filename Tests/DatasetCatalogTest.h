@@ -0,0 +1,17 @@
+#pragma once
+
+#include <QObject>
+
+/**
+ * @brief Tests for DatasetCatalog class.
+ */
+class DatasetCatalogTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    static void testEntries();
+
+    static void testReloadedEntries();
+
+    static void testAddedAndRemovedDataset();
+};
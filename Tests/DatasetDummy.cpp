@@ -12,9 +12,6 @@ std::tuple<bool, QVector<QVector<QVariant> > > DatasetDummy::getSample()
     return {true, {}};
 }
 
-std::tuple<bool, QVector<QVector<QVariant> > > DatasetDummy::getAllData()
-{
-    return {true, {}};
-}
+bool DatasetDummy::pushAllData() { return true; }
 
 void DatasetDummy::closeZip() {}
@@ -13,7 +13,7 @@ protected:
 
     std::tuple<bool, QVector<QVector<QVariant>>> getSample() override;
 
-    std::tuple<bool, QVector<QVector<QVariant>>> getAllData() override;
+    bool pushAllData() override;
 
     void closeZip() override;
 };
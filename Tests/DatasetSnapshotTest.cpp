@@ -0,0 +1,125 @@
+#include "DatasetSnapshotTest.h"
+
+#include <QThread>
+#include <QtTest/QtTest>
+
+#include <Common/DatasetUtilities.h>
+#include <Datasets/Dataset.h>
+#include <Datasets/DatasetSnapshot.h>
+
+#include "DatasetCommon.h"
+
+namespace
+{
+std::unique_ptr<Dataset> loadExampleData()
+{
+    std::unique_ptr<Dataset> dataset{DatasetCommon::createDataset(
+        QStringLiteral("ExampleData"), DatasetUtilities::getDatasetsDir())};
+    dataset->initialize();
+    DatasetCommon::activateAllDatasetColumns(*dataset);
+    dataset->loadData();
+    return dataset;
+}
+
+double computeChecksum(const DatasetSnapshot& snapshot)
+{
+    double checksum{0.};
+    for (int column = 0; column < snapshot.columnCount(); ++column)
+    {
+        const DataColumn& dataColumn{snapshot.getColumn(column)};
+        for (int row = 0; row < snapshot.rowCount(); ++row)
+        {
+            if (dataColumn.isNull(row))
+                continue;
+            switch (dataColumn.getColumnType())
+            {
+                case ColumnType::NUMBER:
+                    checksum += dataColumn.getNumber(row);
+                    break;
+                case ColumnType::DATE:
+                    checksum += dataColumn.getJulianDay(row);
+                    break;
+                case ColumnType::STRING:
+                    checksum +=
+                        static_cast<double>(dataColumn.getString(row).size());
+                    break;
+                case ColumnType::UNKNOWN:
+                    break;
+            }
+        }
+    }
+    return checksum;
+}
+}  // namespace
+
+void DatasetSnapshotTest::testSnapshotMatchesDataset()
+{
+    const std::unique_ptr<Dataset> dataset{loadExampleData()};
+    const std::shared_ptr<const DatasetSnapshot> snapshot{
+        dataset->getSnapshot()};
+    QVERIFY(snapshot != nullptr);
+    QCOMPARE(snapshot->rowCount(), static_cast<int>(dataset->rowCount()));
+    QCOMPARE(snapshot->columnCount(),
+             static_cast<int>(dataset->columnCount()));
+
+    for (int column = 0; column < snapshot->columnCount(); ++column)
+    {
+        const DataColumn& dataColumn{snapshot->getColumn(column)};
+        QCOMPARE(dataColumn.getColumnType(), dataset->getColumnFormat(column));
+        const auto nullCount{
+            static_cast<unsigned int>(dataColumn.getValidity().count(false))};
+        QCOMPARE(nullCount, dataset->getColumnStatistics(column).nullCount_);
+        if (dataColumn.getColumnType() == ColumnType::STRING)
+            QCOMPARE(dataColumn.getDictionary(),
+                     dataset->getStringList(column));
+    }
+}
+
+void DatasetSnapshotTest::testSnapshotOutlivesDataset()
+{
+    std::unique_ptr<Dataset> dataset{loadExampleData()};
+    const std::shared_ptr<const DatasetSnapshot> snapshot{
+        dataset->getSnapshot()};
+    const double expectedChecksum{computeChecksum(*snapshot)};
+    // Deep copies, independent of strings kept by snapshot.
+    QStringList dictionaries;
+    for (int column = 0; column < snapshot->columnCount(); ++column)
+    {
+        const DataColumn& dataColumn{snapshot->getColumn(column)};
+        for (const QString& string : dataColumn.getDictionary())
+            dictionaries << QString(string.unicode(), string.size());
+    }
+
+    dataset.reset();
+
+    QCOMPARE(computeChecksum(*snapshot), expectedChecksum);
+    QStringList dictionariesAfterReset;
+    for (int column = 0; column < snapshot->columnCount(); ++column)
+        dictionariesAfterReset << snapshot->getColumn(column).getDictionary();
+    QCOMPARE(dictionariesAfterReset, dictionaries);
+}
+
+void DatasetSnapshotTest::testConcurrentReads()
+{
+    std::unique_ptr<Dataset> dataset{loadExampleData()};
+    const std::shared_ptr<const DatasetSnapshot> snapshot{
+        dataset->getSnapshot()};
+    const double expectedChecksum{computeChecksum(*snapshot)};
+
+    const int threadCount{4};
+    QVector<double> checksums(threadCount, 0.);
+    std::vector<std::unique_ptr<QThread>> threads;
+    for (int i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back(QThread::create(
+            [snapshot, &checksum = checksums[i]]()
+            { checksum = computeChecksum(*snapshot); }));
+        threads.back()->start();
+    }
+    dataset.reset();
+    for (const auto& thread : threads)
+        thread->wait();
+
+    for (const double checksum : checksums)
+        QCOMPARE(checksum, expectedChecksum);
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <QObject>
+
+/**
+ * @brief Tests for DatasetSnapshot class.
+ */
+class DatasetSnapshotTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    static void testSnapshotMatchesDataset();
+
+    static void testSnapshotOutlivesDataset();
+
+    static void testConcurrentReads();
+};
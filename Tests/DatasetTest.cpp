@@ -2,8 +2,11 @@
 
 #include <QtTest/QtTest>
 
+#include <Common/DatasetUtilities.h>
 #include <Constants.h>
+#include <Datasets/Dataset.h>
 
+#include "DatasetCommon.h"
 #include "DatasetDummy.h"
 
 void DatasetTest::testGetColumnFormatColumnsSet()
@@ -32,3 +35,83 @@ void DatasetTest::testGetColumnFormatColumnsNotSet()
     QVERIFY(!ok);
     QCOMPARE(column, Constants::NOT_SET_COLUMN);
 }
+
+void DatasetTest::testEstimateMemoryUsage()
+{
+    std::unique_ptr<Dataset> dataset{DatasetCommon::createDataset(
+        QStringLiteral("ExampleData"), DatasetUtilities::getDatasetsDir())};
+    QVERIFY(dataset->initialize());
+    DatasetCommon::activateAllDatasetColumns(*dataset);
+    const quint64 allColumnsEstimate{dataset->estimateMemoryUsage()};
+
+    QVector<bool> activeColumns(static_cast<int>(dataset->columnCount()),
+                                false);
+    activeColumns[0] = true;
+    dataset->setActiveColumns(activeColumns);
+    QVERIFY(dataset->estimateMemoryUsage() < allColumnsEstimate);
+
+    DatasetCommon::activateAllDatasetColumns(*dataset);
+    QVERIFY(dataset->loadData());
+    QVERIFY(dataset->getMemoryUsage().total() <= allColumnsEstimate);
+}
+
+void DatasetTest::testLimitRows()
+{
+    std::unique_ptr<Dataset> dataset{DatasetCommon::createDataset(
+        QStringLiteral("ExampleData"), DatasetUtilities::getDatasetsDir())};
+    QVERIFY(dataset->initialize());
+    DatasetCommon::activateAllDatasetColumns(*dataset);
+    const quint64 fullEstimate{dataset->estimateMemoryUsage()};
+
+    const unsigned int rowLimit{10};
+    dataset->limitRows(rowLimit);
+    QVERIFY(dataset->estimateMemoryUsage() < fullEstimate);
+    QVERIFY(dataset->loadData());
+    QCOMPARE(dataset->rowCount(), rowLimit);
+    QCOMPARE(dataset->getData(rowLimit - 1, 0).isValid(), true);
+}
+
+void DatasetTest::testCancelLoading()
+{
+    std::unique_ptr<Dataset> dataset{DatasetCommon::createDataset(
+        QStringLiteral("ExampleData"), DatasetUtilities::getDatasetsDir())};
+    QVERIFY(dataset->initialize());
+    DatasetCommon::activateAllDatasetColumns(*dataset);
+
+    dataset->cancelLoading();
+    QVERIFY(!dataset->loadData());
+    QVERIFY(dataset->getSnapshot() == nullptr);
+    QCOMPARE(dataset->getMemoryUsage().total(), 0ULL);
+}
+
+void DatasetTest::testCancelInitialization()
+{
+    std::unique_ptr<Dataset> dataset{DatasetCommon::createDataset(
+        QStringLiteral("ExampleData"), DatasetUtilities::getDatasetsDir())};
+    dataset->cancelLoading();
+    QVERIFY(!dataset->initialize());
+}
+
+void DatasetTest::testSampleDataKept()
+{
+    std::unique_ptr<Dataset> dataset{DatasetCommon::createDataset(
+        QStringLiteral("ExampleData"), DatasetUtilities::getDatasetsDir())};
+    QVERIFY(dataset->initialize());
+
+    const QVector<QVector<QVariant>> sampleData{dataset->getSampleData()};
+    QVERIFY(!sampleData.isEmpty());
+    QCOMPARE(dataset->getSampleData(), sampleData);
+    QCOMPARE(dataset->retrieveSampleData(), sampleData);
+}
+
+void DatasetTest::testClearSpillDir()
+{
+    const QString spillDir{DatasetUtilities::getSpillDir()};
+    QVERIFY(QDir().mkpath(spillDir));
+    QFile staleFile(spillDir + "stale.spill");
+    QVERIFY(staleFile.open(QIODevice::WriteOnly));
+    staleFile.close();
+
+    DatasetUtilities::clearSpillDir();
+    QVERIFY(!staleFile.exists());
+}
@@ -9,4 +9,16 @@ private Q_SLOTS:
     static void testGetColumnFormatColumnsSet();
 
     static void testGetColumnFormatColumnsNotSet();
+
+    static void testEstimateMemoryUsage();
+
+    static void testLimitRows();
+
+    static void testCancelLoading();
+
+    static void testCancelInitialization();
+
+    static void testSampleDataKept();
+
+    static void testClearSpillDir();
 };
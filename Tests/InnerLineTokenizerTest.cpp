@@ -0,0 +1,54 @@
+#include "InnerLineTokenizerTest.h"
+
+#include <QtTest/QtTest>
+
+#include <Datasets/InnerLineTokenizer.h>
+
+namespace
+{
+const QVector<ColumnType> columnTypes{ColumnType::STRING, ColumnType::NUMBER,
+                                      ColumnType::DATE, ColumnType::NUMBER};
+
+QVector<QVariant> tokenize(const InnerLineTokenizer& tokenizer,
+                           const QByteArray& line)
+{
+    return tokenizer.tokenize(line.cbegin(), line.cend());
+}
+}  // namespace
+
+void InnerLineTokenizerTest::testAllColumns()
+{
+    const InnerLineTokenizer tokenizer(columnTypes, {});
+    const QVector<QVariant> expected{
+        QVariant(12), QVariant(-3.25), QVariant(QDate(2020, 1, 31)),
+        QVariant(1e6)};
+    QCOMPARE(tokenize(tokenizer, "12;-3.25;2458880;1000000"), expected);
+}
+
+void InnerLineTokenizerTest::testInactiveColumnsSkipped()
+{
+    const InnerLineTokenizer tokenizer(columnTypes,
+                                       {false, true, false, false});
+    const QVector<QVariant> expected{QVariant(7.5)};
+    QCOMPARE(tokenize(tokenizer, "not;7.5;converted;at all"), expected);
+}
+
+void InnerLineTokenizerTest::testEmptyFields()
+{
+    const InnerLineTokenizer tokenizer(columnTypes, {});
+    const QVector<QVariant> expected{
+        QVariant(QMetaType(QMetaType::Int)),
+        QVariant(QMetaType(QMetaType::Double)),
+        QVariant(QMetaType(QMetaType::QDate)),
+        QVariant(QMetaType(QMetaType::Double))};
+    QCOMPARE(tokenize(tokenizer, ";;;"), expected);
+}
+
+void InnerLineTokenizerTest::testMissingFields()
+{
+    const InnerLineTokenizer tokenizer(columnTypes, {});
+    const QVector<QVariant> expected{
+        QVariant(1), QVariant(2.), QVariant(QMetaType(QMetaType::QDate)),
+        QVariant(QMetaType(QMetaType::Double))};
+    QCOMPARE(tokenize(tokenizer, "1;2"), expected);
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <QObject>
+
+/**
+ * @brief Tests for InnerLineTokenizer class.
+ */
+class InnerLineTokenizerTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    static void testAllColumns();
+
+    static void testInactiveColumnsSkipped();
+
+    static void testEmptyFields();
+
+    static void testMissingFields();
+};
@@ -9,6 +9,7 @@
 
 #include <Common/FileUtilities.h>
 #include <Datasets/DatasetInner.h>
+#include <Datasets/StatisticsCache.h>
 #include <Export/ExportVbx.h>
 #include <ModelsAndViews/FilteringProxyModel.h>
 #include <ModelsAndViews/TableModel.h>
@@ -17,6 +18,32 @@
 #include "DatasetCommon.h"
 #include "DatasetUtilities.h"
 
+namespace
+{
+bool isAcceptedByFilter(const LoadFilter& filter, const QVariant& value)
+{
+    if (value.isNull())
+        return false;
+
+    switch (filter.getColumnType())
+    {
+        case ColumnType::NUMBER:
+            return filter.matches(value.toDouble());
+
+        case ColumnType::DATE:
+            return filter.matches(
+                static_cast<double>(value.toDate().toJulianDay()));
+
+        case ColumnType::STRING:
+            return filter.getMatchingCodes({value.toString()}).testBit(0);
+
+        case ColumnType::UNKNOWN:
+            break;
+    }
+    return false;
+}
+}  // namespace
+
 void InnerTests::initTestCase()
 {
     // generateDumpData();
@@ -54,7 +81,7 @@ void InnerTests::testExport()
     QByteArray exportedByteArray;
     QBuffer exportedBuffer(&exportedByteArray);
     exportedBuffer.open(QIODevice::WriteOnly);
-    generateVbxFile(datasetName, exportedBuffer, {});
+    generateVbxFile(datasetName, exportedBuffer, {}, DatasetFormat::TEXT);
 
     checkExport(datasetName, exportedBuffer);
 }
@@ -105,8 +132,10 @@ void InnerTests::checkExportedDefinitions(QuaZip& zipOriginal,
     DatasetCommon::xmlsAreEqual(generatedData, originalData);
 }
 
-void InnerTests::generateVbxFile(const QString& datasetName, QBuffer& buffer,
-                                 const QVector<bool>& activeColumns)
+void InnerTests::generateVbxFile(const QString& datasetName,
+                                 QIODevice& device,
+                                 const QVector<bool>& activeColumns,
+                                 DatasetFormat format, unsigned int blockRows)
 {
     std::unique_ptr<Dataset> dataset{DatasetCommon::createDataset(
         datasetName, DatasetUtilities::getDatasetsDir())};
@@ -124,8 +153,20 @@ void InnerTests::generateVbxFile(const QString& datasetName, QBuffer& buffer,
     QTableView view;
     view.setModel(&proxyModel);
 
-    ExportVbx exportVbx;
-    exportVbx.generateVbx(view, buffer);
+    ExportVbx exportVbx(format);
+    exportVbx.setBlockRowCount(blockRows);
+    exportVbx.generateVbx(view, device);
+}
+
+QString InnerTests::generateColumnarDataset(const QString& datasetName,
+                                           unsigned int blockRows)
+{
+    const QString columnarName{datasetName + "_columnar"};
+    QFile file(DatasetUtilities::getDatasetsDir() + columnarName +
+               DatasetUtilities::getDatasetExtension());
+    generateVbxFile(datasetName, file, {}, DatasetFormat::COLUMNAR,
+                    blockRows);
+    return columnarName;
 }
 
 void InnerTests::checkExport(const QString& datasetName,
@@ -158,11 +199,422 @@ void InnerTests::testPartialData()
     activeColumns[5] = true;
     activeColumns[6] = true;
     generateVbxFile(QStringLiteral("ExampleData"), exportedBuffer,
-                    activeColumns);
+                    activeColumns, DatasetFormat::TEXT);
 
     checkExport(QStringLiteral("ExampleDataPartial"), exportedBuffer);
 }
 
+void InnerTests::testColumnarFormat_data()
+{
+    addTestCases(QStringLiteral("Test columnar format"));
+}
+
+void InnerTests::testColumnarFormat()
+{
+    QFETCH(const QString, datasetName);
+    const QString columnarName{generateColumnarDataset(datasetName)};
+
+    std::unique_ptr<Dataset> original{DatasetCommon::createDataset(
+        datasetName, DatasetUtilities::getDatasetsDir())};
+    QVERIFY(original->initialize());
+    std::unique_ptr<Dataset> columnar{DatasetCommon::createDataset(
+        columnarName, DatasetUtilities::getDatasetsDir())};
+    QVERIFY(columnar->initialize());
+    QVERIFY(DatasetCommon::xmlsAreEqual(
+        columnar->definitionToXml(columnar->rowCount()),
+        original->definitionToXml(original->rowCount())));
+    QCOMPARE(columnar->retrieveSampleData(), original->retrieveSampleData());
+
+    DatasetCommon::activateAllDatasetColumns(*columnar);
+    QVERIFY(columnar->loadData());
+    QVERIFY(columnar->isValid());
+    DatasetCommon::compareExportDataWithDump(
+        std::move(columnar), DatasetUtilities::getDatasetsDir() + datasetName);
+
+    DatasetUtilities::removeDataset(columnarName);
+}
+
+void InnerTests::testColumnarFormatPartialData()
+{
+    const QString datasetName{QStringLiteral("ExampleData")};
+    const QString columnarName{generateColumnarDataset(datasetName)};
+    QVector<bool> activeColumns(7, false);
+    activeColumns[1] = true;
+    activeColumns[2] = true;
+    activeColumns[5] = true;
+    activeColumns[6] = true;
+
+    std::unique_ptr<Dataset> original{DatasetCommon::createDataset(
+        datasetName, DatasetUtilities::getDatasetsDir())};
+    QVERIFY(original->initialize());
+    original->setActiveColumns(activeColumns);
+    QVERIFY(original->loadData());
+    std::unique_ptr<Dataset> columnar{DatasetCommon::createDataset(
+        columnarName, DatasetUtilities::getDatasetsDir())};
+    QVERIFY(columnar->initialize());
+    columnar->setActiveColumns(activeColumns);
+    QVERIFY(columnar->loadData());
+
+    QCOMPARE(columnar->columnCount(), original->columnCount());
+    QCOMPARE(columnar->rowCount(), original->rowCount());
+    for (Column column = 0;
+         column < static_cast<Column>(original->columnCount()); ++column)
+        for (int row = 0; row < static_cast<int>(original->rowCount()); ++row)
+            QCOMPARE(columnar->getData(row, column),
+                     original->getData(row, column));
+
+    DatasetUtilities::removeDataset(columnarName);
+}
+
+void InnerTests::testColumnarFormatFromSnapshot()
+{
+    // Small blocks to get last block shorter than others.
+    const QString datasetName{QStringLiteral("ExampleData")};
+    const QString snapshotName{datasetName + "_snapshot"};
+    const unsigned int blockRows{8};
+    DatasetInner original(datasetName);
+    QVERIFY(original.initialize());
+    DatasetCommon::activateAllDatasetColumns(original);
+    QVERIFY(original.loadData());
+    {
+        QFile file(DatasetUtilities::getDatasetsDir() + snapshotName +
+                   DatasetUtilities::getDatasetExtension());
+        ExportVbx exportVbx(DatasetFormat::COLUMNAR);
+        exportVbx.setBlockRowCount(blockRows);
+        QVERIFY(exportVbx.generateVbx(
+            *original.getSnapshot(),
+            original.definitionToXml(original.rowCount(),
+                                     DatasetFormat::COLUMNAR, blockRows),
+            file));
+    }
+
+    DatasetInner exported(snapshotName);
+    QVERIFY(exported.initialize());
+    DatasetCommon::activateAllDatasetColumns(exported);
+    QVERIFY(exported.loadData());
+    QCOMPARE(exported.columnCount(), original.columnCount());
+    QCOMPARE(exported.rowCount(), original.rowCount());
+    for (Column column = 0;
+         column < static_cast<Column>(original.columnCount()); ++column)
+        for (int row = 0; row < static_cast<int>(original.rowCount()); ++row)
+            QCOMPARE(exported.getData(row, column),
+                     original.getData(row, column));
+
+    DatasetUtilities::removeDataset(snapshotName);
+}
+
+QString InnerTests::generateRepeatedDataset(const QString& datasetName,
+                                           int repeats, bool uniqueStrings)
+{
+    const QString repeatedName{datasetName + "_repeated"};
+    DatasetInner original(datasetName);
+    original.initialize();
+
+    QuaZip originalZip(DatasetUtilities::getDatasetsDir() + datasetName +
+                       DatasetUtilities::getDatasetExtension());
+    originalZip.open(QuaZip::mdUnzip);
+    QByteArray data{loadDataFromZip(
+        originalZip, DatasetUtilities::getDatasetDataFilename())};
+    if (!data.endsWith('\n'))
+        data.append('\n');
+    QByteArray strings{loadDataFromZip(
+        originalZip, DatasetUtilities::getDatasetStringsFilename())};
+    QByteArray repeatedData{data.repeated(repeats)};
+    if (uniqueStrings)
+    {
+        // First field of each line is replaced by index of new string.
+        // Index 0 is reserved for empty string.
+        qsizetype nextIndex{strings.count('\n') + 2};
+        QByteArray uniqueData;
+        for (const QByteArray& line : repeatedData.split('\n'))
+        {
+            if (line.isEmpty())
+                continue;
+            strings.append("\nunique " + QByteArray::number(nextIndex));
+            uniqueData.append(QByteArray::number(nextIndex) +
+                              line.sliced(line.indexOf(';')) + '\n');
+            ++nextIndex;
+        }
+        repeatedData = uniqueData;
+    }
+
+    QuaZip zip(DatasetUtilities::getDatasetsDir() + repeatedName +
+               DatasetUtilities::getDatasetExtension());
+    zip.open(QuaZip::mdCreate);
+    QuaZipFile zipFile(&zip);
+    zipFile.open(
+        QIODevice::WriteOnly,
+        QuaZipNewInfo(DatasetUtilities::getDatasetDefinitionFilename()));
+    zipFile.write(original.definitionToXml(
+        static_cast<unsigned int>(repeats) * original.rowCount()));
+    zipFile.close();
+    zipFile.open(QIODevice::WriteOnly,
+                 QuaZipNewInfo(DatasetUtilities::getDatasetStringsFilename()));
+    zipFile.write(strings);
+    zipFile.close();
+    zipFile.open(QIODevice::WriteOnly,
+                 QuaZipNewInfo(DatasetUtilities::getDatasetDataFilename()));
+    zipFile.write(repeatedData);
+    zipFile.close();
+    return repeatedName;
+}
+
+void InnerTests::testParallelParsing()
+{
+    // Repeat data to get file big enough to be split into many blocks.
+    const QString datasetName{QStringLiteral("ExampleData")};
+    const int repeats{1000};
+    DatasetInner original(datasetName);
+    QVERIFY(original.initialize());
+    DatasetCommon::activateAllDatasetColumns(original);
+    QVERIFY(original.loadData());
+    const QString bigName{generateRepeatedDataset(datasetName, repeats)};
+
+    DatasetInner big(bigName);
+    QVERIFY(big.initialize());
+    DatasetCommon::activateAllDatasetColumns(big);
+    QVERIFY(big.loadData());
+    QCOMPARE(big.rowCount(), repeats * original.rowCount());
+    for (int row = 0; row < static_cast<int>(big.rowCount()); ++row)
+    {
+        const int originalRow{row % static_cast<int>(original.rowCount())};
+        for (Column column = 0;
+             column < static_cast<Column>(original.columnCount()); ++column)
+            QCOMPARE(big.getData(row, column),
+                     original.getData(originalRow, column));
+    }
+
+    DatasetUtilities::removeDataset(bigName);
+}
+
+void InnerTests::testParallelFilling_data()
+{
+    QTest::addColumn<QString>("datasetName");
+    QTest::newRow("ExampleData") << QStringLiteral("ExampleData");
+    QTest::newRow("pustePola") << QStringLiteral("pustePola");
+}
+
+void InnerTests::testParallelFilling()
+{
+    // Rows of many blocks are written into columns by parsers at once.
+    QFETCH(const QString, datasetName);
+    const int repeats{3000};
+    const QString repeatedName{generateRepeatedDataset(datasetName, repeats)};
+    std::unique_ptr<Dataset> dataset{std::make_unique<DatasetInner>(
+        repeatedName)};
+    QVERIFY(dataset->initialize());
+    DatasetCommon::activateAllDatasetColumns(*dataset);
+    QVERIFY(dataset->loadData());
+
+    TableModel model(std::move(dataset));
+    FilteringProxyModel proxyModel;
+    proxyModel.setSourceModel(&model);
+    QTableView view;
+    view.setModel(&proxyModel);
+    const QStringList actualLines{
+        DatasetCommon::getExportedTsv(view).split(QStringLiteral("\n"))};
+
+    const QString dumpFilePath{DatasetUtilities::getDatasetsDir() +
+                               datasetName + Common::getDataTsvDumpSuffix()};
+    const QString dump{FileUtilities::loadFile(dumpFilePath).second};
+    const QStringList dumpLines{dump.split(QStringLiteral("\n"))};
+    QStringList expectedLines{dumpLines.first()};
+    for (int i = 0; i < repeats; ++i)
+        expectedLines.append(dumpLines.mid(1));
+
+    QCOMPARE(actualLines.size(), expectedLines.size());
+    for (int i = 0; i < actualLines.size(); ++i)
+        QCOMPARE(actualLines[i], expectedLines[i]);
+
+    DatasetUtilities::removeDataset(repeatedName);
+}
+
+void InnerTests::testColumnarFormatLoadFilter()
+{
+    // Small blocks to get many zones from example data.
+    const QString datasetName{QStringLiteral("ExampleData")};
+    const unsigned int blockRows{8};
+    const QString columnarName{
+        generateColumnarDataset(datasetName, blockRows)};
+    DatasetInner original(datasetName);
+    QVERIFY(original.initialize());
+    DatasetCommon::activateAllDatasetColumns(original);
+    QVERIFY(original.loadData());
+
+    checkLoadFilter(columnarName, original, {});
+
+    const Column dateColumn{2};
+    checkLoadFilter(columnarName, original,
+                    LoadFilter::createDateFilter(
+                        dateColumn, original.getData(10, dateColumn).toDate(),
+                        original.getData(20, dateColumn).toDate()));
+
+    const Column numberColumn{1};
+    checkLoadFilter(columnarName, original,
+                    LoadFilter::createNumberFilter(numberColumn, 10., 30.));
+
+    const Column stringColumn{0};
+    checkLoadFilter(
+        columnarName, original,
+        LoadFilter::createStringFilter(
+            stringColumn, {original.getData(3, stringColumn).toString(),
+                           original.getData(40, stringColumn).toString()}));
+
+    checkLoadFilter(columnarName, original,
+                    LoadFilter::createNumberFilter(numberColumn, -2., -1.));
+
+    DatasetUtilities::removeDataset(columnarName);
+}
+
+void InnerTests::testColumnarFormatLoadFilterManyStrings()
+{
+    // Single block has more distinct strings than zone map lists.
+    const int repeats{20};
+    const QString datasetName{generateRepeatedDataset(
+        QStringLiteral("ExampleData"), repeats, true)};
+    const QString columnarName{generateColumnarDataset(datasetName)};
+    DatasetInner original(datasetName);
+    QVERIFY(original.initialize());
+    DatasetCommon::activateAllDatasetColumns(original);
+    QVERIFY(original.loadData());
+    const Column stringColumn{0};
+    QVERIFY(original.getStringList(stringColumn).size() >
+            static_cast<qsizetype>(COLUMNAR_ZONE_MAX_CODES));
+
+    const int row{500};
+    checkLoadFilter(columnarName, original,
+                    LoadFilter::createStringFilter(
+                        stringColumn,
+                        {original.getData(row, stringColumn).toString()}));
+    checkLoadFilter(columnarName, original,
+                    LoadFilter::createStringFilter(
+                        stringColumn, {QStringLiteral("missing")}));
+
+    DatasetUtilities::removeDataset(columnarName);
+    DatasetUtilities::removeDataset(datasetName);
+}
+
+void InnerTests::testColumnarFormatLoadFilterPartialBlocks()
+{
+    // Example data has 55 rows, so last block of 8 rows is shorter.
+    const QString datasetName{QStringLiteral("ExampleData")};
+    const unsigned int blockRows{8};
+    const QString columnarName{
+        generateColumnarDataset(datasetName, blockRows)};
+    DatasetInner original(datasetName);
+    QVERIFY(original.initialize());
+    DatasetCommon::activateAllDatasetColumns(original);
+    QVERIFY(original.loadData());
+
+    const Column stringColumn{0};
+    const int middleRow{20};
+    const int lastRow{static_cast<int>(original.rowCount()) - 1};
+    const LoadFilter filter{LoadFilter::createStringFilter(
+        stringColumn, {original.getData(middleRow, stringColumn).toString(),
+                       original.getData(lastRow, stringColumn).toString()})};
+    checkLoadFilter(columnarName, original, filter);
+
+    // Strings of column are only ones present in loaded rows.
+    DatasetInner columnar(columnarName);
+    QVERIFY(columnar.initialize());
+    DatasetCommon::activateAllDatasetColumns(columnar);
+    columnar.setLoadFilter(filter);
+    QVERIFY(columnar.loadData());
+    for (Column column = 0;
+         column < static_cast<Column>(columnar.columnCount()); ++column)
+    {
+        if (columnar.getColumnFormat(column) != ColumnType::STRING)
+            continue;
+        QStringList loadedStrings;
+        for (int row = 0; row < static_cast<int>(columnar.rowCount()); ++row)
+        {
+            const QVariant value{columnar.getData(row, column)};
+            if (!value.isNull() && !loadedStrings.contains(value.toString()))
+                loadedStrings.append(value.toString());
+        }
+        loadedStrings.sort();
+        QCOMPARE(columnar.getColumnStatistics(column).sortedStrings_,
+                 loadedStrings);
+    }
+
+    DatasetUtilities::removeDataset(columnarName);
+}
+
+void InnerTests::testStatisticsCache()
+{
+    const QString columnarName{
+        generateColumnarDataset(QStringLiteral("ExampleData"))};
+    const QString cachePath{DatasetUtilities::getDatasetsDir() + columnarName +
+                            DatasetUtilities::getDatasetStatisticsExtension()};
+    DatasetInner dataset(columnarName);
+    QVERIFY(dataset.initialize());
+    DatasetCommon::activateAllDatasetColumns(dataset);
+    QVERIFY(dataset.loadData());
+    QVERIFY(QFile::exists(cachePath));
+
+    // Change cached entry to see it is used by next load.
+    const Column stringColumn{0};
+    const unsigned int changedDistinctCount{12345};
+    {
+        QuaZip zip(DatasetUtilities::getDatasetsDir() + columnarName +
+                   DatasetUtilities::getDatasetExtension());
+        QVERIFY(zip.open(QuaZip::mdUnzip));
+        StatisticsCache cache(cachePath);
+        cache.load(StatisticsCache::computeKey(zip));
+        auto [found, entry] = cache.get(stringColumn);
+        QVERIFY(found);
+        QCOMPARE(entry.distinctCount_,
+                 dataset.getColumnStatistics(stringColumn).distinctCount_);
+        entry.distinctCount_ = changedDistinctCount;
+        cache.insert(stringColumn, entry);
+        QVERIFY(cache.save());
+    }
+
+    DatasetInner reopened(columnarName);
+    QVERIFY(reopened.initialize());
+    DatasetCommon::activateAllDatasetColumns(reopened);
+    QVERIFY(reopened.loadData());
+    QCOMPARE(reopened.getColumnStatistics(stringColumn).distinctCount_,
+             changedDistinctCount);
+    for (Column column = 0; column < static_cast<Column>(dataset.columnCount());
+         ++column)
+        QCOMPARE(reopened.getColumnStatistics(column).sortedStrings_,
+                 dataset.getColumnStatistics(column).sortedStrings_);
+
+    QVERIFY(DatasetUtilities::removeDataset(columnarName));
+    QVERIFY(!QFile::exists(cachePath));
+}
+
+void InnerTests::checkLoadFilter(const QString& columnarName,
+                                 const Dataset& original,
+                                 const LoadFilter& filter)
+{
+    DatasetInner columnar(columnarName);
+    QVERIFY(columnar.initialize());
+    QVERIFY(columnar.supportsLoadFilter());
+    DatasetCommon::activateAllDatasetColumns(columnar);
+    columnar.setLoadFilter(filter);
+    QVERIFY(columnar.loadData());
+
+    // Loaded rows keep order of original rows accepted by filter.
+    int row{0};
+    for (int originalRow = 0;
+         originalRow < static_cast<int>(original.rowCount()); ++originalRow)
+    {
+        if (!filter.isEmpty() &&
+            !isAcceptedByFilter(
+                filter, original.getData(originalRow, filter.getColumn())))
+            continue;
+        QVERIFY(row < static_cast<int>(columnar.rowCount()));
+        for (Column column = 0;
+             column < static_cast<Column>(original.columnCount()); ++column)
+            QCOMPARE(columnar.getData(row, column),
+                     original.getData(originalRow, column));
+        ++row;
+    }
+    QCOMPARE(columnar.rowCount(), static_cast<unsigned int>(row));
+}
+
 void InnerTests::addTestCases(const QString& testNamePrefix)
 {
     QTest::addColumn<QString>("datasetName");
@@ -5,9 +5,13 @@
 #include <QObject>
 #include <QVector>
 
+#include <Common/DatasetFormat.h>
+
 class Dataset;
+class LoadFilter;
 class QTableView;
 class QBuffer;
+class QIODevice;
 class QuaZip;
 
 /**
@@ -30,6 +34,26 @@ private Q_SLOTS:
 
     static void testPartialData();
 
+    void testColumnarFormat_data();
+    static void testColumnarFormat();
+
+    static void testColumnarFormatPartialData();
+
+    static void testColumnarFormatFromSnapshot();
+
+    static void testParallelParsing();
+
+    static void testParallelFilling_data();
+    static void testParallelFilling();
+
+    static void testColumnarFormatLoadFilter();
+
+    static void testColumnarFormatLoadFilterManyStrings();
+
+    static void testColumnarFormatLoadFilterPartialBlocks();
+
+    static void testStatisticsCache();
+
 private:
     void generateDumpData();
 
@@ -51,8 +75,42 @@ private:
     static void checkExportedDefinitions(QuaZip& zipOriginal,
                                          QuaZip& zipGenerated);
 
-    static void generateVbxFile(const QString& datasetName, QBuffer& buffer,
-                                const QVector<bool>& activeColumns);
+    static void generateVbxFile(const QString& datasetName, QIODevice& device,
+                                const QVector<bool>& activeColumns,
+                                DatasetFormat format,
+                                unsigned int blockRows = COLUMNAR_BLOCK_ROWS);
+
+    /**
+     * @brief Export dataset in columnar format to datasets dir.
+     * @param datasetName Name of exported dataset.
+     * @param blockRows Number of rows in blocks of columns.
+     * @return Name of created dataset.
+     */
+    static QString generateColumnarDataset(
+        const QString& datasetName,
+        unsigned int blockRows = COLUMNAR_BLOCK_ROWS);
+
+    /**
+     * @brief Write dataset with data of other one repeated many times.
+     * @param datasetName Name of repeated dataset.
+     * @param repeats Number of repeats.
+     * @param uniqueStrings Flag to replace strings of first column with
+     * distinct ones.
+     * @return Name of created dataset.
+     */
+    static QString generateRepeatedDataset(const QString& datasetName,
+                                           int repeats,
+                                           bool uniqueStrings = false);
+
+    /**
+     * @brief Check that only rows accepted by filter are loaded.
+     * @param columnarName Name of dataset in columnar format.
+     * @param original Loaded dataset with all rows.
+     * @param filter Load filter.
+     */
+    static void checkLoadFilter(const QString& columnarName,
+                                const Dataset& original,
+                                const LoadFilter& filter);
 
     const QVector<QString> testFileNames_{
         "ExampleData", "po0_dmg", "po0_dmg2_bez_dat",
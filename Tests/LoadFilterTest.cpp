@@ -0,0 +1,62 @@
+#include "LoadFilterTest.h"
+
+#include <QtTest/QtTest>
+
+#include <Datasets/LoadFilter.h>
+
+void LoadFilterTest::testEmptyFilter()
+{
+    const LoadFilter filter;
+    QVERIFY(filter.isEmpty());
+    QCOMPARE(filter.getColumn(), -1);
+}
+
+void LoadFilterTest::testNumberRange()
+{
+    const LoadFilter filter{LoadFilter::createNumberFilter(3, 10., 20.)};
+    QVERIFY(!filter.isEmpty());
+    QCOMPARE(filter.getColumn(), 3);
+    QCOMPARE(filter.getColumnType(), ColumnType::NUMBER);
+
+    QVERIFY(filter.matches(10.));
+    QVERIFY(filter.matches(20.));
+    QVERIFY(!filter.matches(9.99));
+    QVERIFY(!filter.matches(20.01));
+
+    QVERIFY(filter.mayMatch(0., 10.));
+    QVERIFY(filter.mayMatch(12., 15.));
+    QVERIFY(filter.mayMatch(0., 100.));
+    QVERIFY(!filter.mayMatch(0., 9.));
+    QVERIFY(!filter.mayMatch(21., 30.));
+}
+
+void LoadFilterTest::testDateRange()
+{
+    const QDate from{2020, 1, 1};
+    const QDate to{2020, 3, 31};
+    const LoadFilter filter{LoadFilter::createDateFilter(1, from, to)};
+    QCOMPARE(filter.getColumnType(), ColumnType::DATE);
+
+    const auto julianDay{[](QDate date)
+                         { return static_cast<double>(date.toJulianDay()); }};
+    QVERIFY(filter.matches(julianDay(from)));
+    QVERIFY(filter.matches(julianDay(to)));
+    QVERIFY(!filter.matches(julianDay(to.addDays(1))));
+    QVERIFY(filter.mayMatch(julianDay({2019, 12, 1}), julianDay(from)));
+    QVERIFY(!filter.mayMatch(julianDay({2019, 1, 1}),
+                             julianDay({2019, 12, 31})));
+}
+
+void LoadFilterTest::testStringCodes()
+{
+    const LoadFilter filter{
+        LoadFilter::createStringFilter(0, {"b", "d", "missing"})};
+    QCOMPARE(filter.getColumnType(), ColumnType::STRING);
+
+    const QBitArray codes{filter.getMatchingCodes({"a", "b", "c", "d"})};
+    QCOMPARE(codes.size(), static_cast<qsizetype>(4));
+    QVERIFY(!codes.testBit(0));
+    QVERIFY(codes.testBit(1));
+    QVERIFY(!codes.testBit(2));
+    QVERIFY(codes.testBit(3));
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <QObject>
+
+/**
+ * @brief Tests for LoadFilter class.
+ */
+class LoadFilterTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    static void testEmptyFilter();
+
+    static void testNumberRange();
+
+    static void testDateRange();
+
+    static void testStringCodes();
+};
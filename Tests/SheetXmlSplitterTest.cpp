@@ -0,0 +1,96 @@
+#include "SheetXmlSplitterTest.h"
+
+#include <limits>
+
+#include <QBuffer>
+#include <QtTest/QtTest>
+#include <QXmlStreamReader>
+
+#include <Datasets/SheetXmlSplitter.h>
+#include <Datasets/SpreadsheetSampler.h>
+
+namespace
+{
+const QByteArray worksheetStart{
+    R"(<?xml version="1.0" encoding="UTF-8" standalone="yes"?>)"
+    "\n"
+    R"(<worksheet xmlns="http://schemas.openxmlformats.org/)"
+    R"(spreadsheetml/2006/main"><dimension ref="A1:B3"/>)"};
+
+QByteArray createSheet(int rowCount)
+{
+    QByteArray sheet{worksheetStart + "<sheetData>"};
+    for (int row = 1; row <= rowCount; ++row)
+        sheet += "<row r=\"" + QByteArray::number(row) + "\"><c r=\"A" +
+                 QByteArray::number(row) + "\"><v>" +
+                 QByteArray::number(row) + "</v></c></row>";
+    return sheet + "</sheetData></worksheet>";
+}
+
+SheetXmlSplitter createSplitter(QBuffer& buffer)
+{
+    buffer.open(QIODevice::ReadOnly);
+    return {buffer, "<sheetData", "</row>", "</sheetData>"};
+}
+}  // namespace
+
+void SheetXmlSplitterTest::testBlocksContainWholeRows()
+{
+    // Big enough to be split into many blocks.
+    const int rowCount{100'000};
+    QByteArray sheet{createSheet(rowCount)};
+    QBuffer buffer(&sheet);
+    SheetXmlSplitter splitter{createSplitter(buffer)};
+    QVERIFY(splitter.findRows());
+
+    int blocks{0};
+    QVector<QVector<QVariant>> rows;
+    QByteArray block;
+    while (splitter.readBlock(block))
+    {
+        ++blocks;
+        QVERIFY(block.startsWith("<worksheet "));
+        QVERIFY(block.endsWith("</worksheet>"));
+        QXmlStreamReader xml(block);
+        rows.append(SpreadsheetSampler::parseXlsxRows(
+            xml, {}, std::numeric_limits<qsizetype>::max()));
+        QVERIFY(!xml.hasError());
+    }
+    QVERIFY(!splitter.hasError());
+    QVERIFY(blocks > 1);
+    QCOMPARE(rows.size(), static_cast<qsizetype>(rowCount));
+    for (int row = 0; row < rowCount; ++row)
+        QCOMPARE(rows[row].constFirst().toDouble(),
+                 static_cast<double>(row + 1));
+}
+
+void SheetXmlSplitterTest::testEmptySheet()
+{
+    QByteArray sheet{worksheetStart + "<sheetData/></worksheet>"};
+    QBuffer buffer(&sheet);
+    SheetXmlSplitter splitter{createSplitter(buffer)};
+    QVERIFY(splitter.findRows());
+    QByteArray block;
+    QVERIFY(!splitter.readBlock(block));
+    QVERIFY(!splitter.hasError());
+}
+
+void SheetXmlSplitterTest::testMissingRows()
+{
+    QByteArray sheet{worksheetStart + "</worksheet>"};
+    QBuffer buffer(&sheet);
+    SheetXmlSplitter splitter{createSplitter(buffer)};
+    QVERIFY(!splitter.findRows());
+}
+
+void SheetXmlSplitterTest::testTruncatedFile()
+{
+    QByteArray sheet{createSheet(10)};
+    sheet.chop(30);
+    QBuffer buffer(&sheet);
+    SheetXmlSplitter splitter{createSplitter(buffer)};
+    QVERIFY(splitter.findRows());
+    QByteArray block;
+    QVERIFY(!splitter.readBlock(block));
+    QVERIFY(splitter.hasError());
+}
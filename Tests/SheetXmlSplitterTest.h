@@ -0,0 +1,19 @@
+#pragma once
+
+#include <QObject>
+
+/**
+ * @brief Tests for SheetXmlSplitter class.
+ */
+class SheetXmlSplitterTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    static void testBlocksContainWholeRows();
+
+    static void testEmptySheet();
+
+    static void testMissingRows();
+
+    static void testTruncatedFile();
+};
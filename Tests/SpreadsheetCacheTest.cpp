@@ -0,0 +1,126 @@
+#include "SpreadsheetCacheTest.h"
+
+#include <QFile>
+#include <QTemporaryDir>
+#include <QThread>
+#include <QtTest/QtTest>
+
+#include <Common/DatasetUtilities.h>
+#include <Datasets/DatasetInner.h>
+#include <Datasets/SpreadsheetCache.h>
+
+#include "Common.h"
+#include "DatasetCommon.h"
+
+namespace
+{
+const quint64 sizeLimit{100};
+
+bool insertFile(SpreadsheetCache& cache, const QString& key, int size)
+{
+    QFile file(cache.getPartialFilePath(key));
+    if (!file.open(QIODevice::WriteOnly) ||
+        file.write(QByteArray(size, 'x')) != size)
+        return false;
+    file.close();
+    return cache.insert(key, cache.getPartialFilePath(key));
+}
+
+void waitForNextTimestamp()
+{
+    // Times of last use are stored with millisecond precision.
+    QThread::msleep(2);
+}
+}  // namespace
+
+void SpreadsheetCacheTest::testComputeKey()
+{
+    const QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+    const QString xlsxPath{directory.filePath(QStringLiteral("a.xlsx"))};
+    const QString odsPath{directory.filePath(QStringLiteral("a.ods"))};
+    QVERIFY(QFile::copy(Common::getSpreadsheetsDir() + "HistVsNormal.xlsx",
+                        xlsxPath));
+    QVERIFY(QFile::copy(Common::getSpreadsheetsDir() + "HistVsNormal.ods",
+                        odsPath));
+
+    const QString sheet{QStringLiteral("Sheet1")};
+    const QString key{SpreadsheetCache::computeKey(xlsxPath, sheet)};
+    QVERIFY(!key.isEmpty());
+    QCOMPARE(SpreadsheetCache::computeKey(xlsxPath, sheet), key);
+    QVERIFY(SpreadsheetCache::computeKey(odsPath, sheet) != key);
+    QVERIFY(SpreadsheetCache::computeKey(xlsxPath, QStringLiteral("Sheet2")) !=
+            key);
+    QVERIFY(SpreadsheetCache::computeKey(
+                directory.filePath(QStringLiteral("missing.xlsx")), sheet)
+                .isEmpty());
+}
+
+void SpreadsheetCacheTest::testEviction()
+{
+    const QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+    SpreadsheetCache cache(directory.path() + "/", sizeLimit);
+    QVERIFY(insertFile(cache, QStringLiteral("a"), 40));
+    waitForNextTimestamp();
+    QVERIFY(insertFile(cache, QStringLiteral("b"), 40));
+    waitForNextTimestamp();
+    cache.markUsed(QStringLiteral("a"));
+    waitForNextTimestamp();
+
+    QVERIFY(insertFile(cache, QStringLiteral("c"), 40));
+    QVERIFY(cache.contains(QStringLiteral("a")));
+    QVERIFY(!cache.contains(QStringLiteral("b")));
+    QVERIFY(cache.contains(QStringLiteral("c")));
+    QVERIFY(!QFile::exists(cache.getFilePath(QStringLiteral("b"))));
+
+    QVERIFY(!insertFile(cache, QStringLiteral("d"), sizeLimit + 1));
+    QVERIFY(!QFile::exists(cache.getFilePath(QStringLiteral("d"))));
+}
+
+void SpreadsheetCacheTest::testReloadedIndex()
+{
+    const QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+    {
+        SpreadsheetCache cache(directory.path() + "/", sizeLimit);
+        QVERIFY(insertFile(cache, QStringLiteral("a"), 40));
+        waitForNextTimestamp();
+        QVERIFY(insertFile(cache, QStringLiteral("b"), 40));
+        waitForNextTimestamp();
+        cache.markUsed(QStringLiteral("a"));
+        waitForNextTimestamp();
+    }
+
+    SpreadsheetCache reloadedCache(directory.path() + "/", sizeLimit);
+    QVERIFY(reloadedCache.contains(QStringLiteral("a")));
+    QVERIFY(reloadedCache.contains(QStringLiteral("b")));
+    QVERIFY(insertFile(reloadedCache, QStringLiteral("c"), 40));
+    QVERIFY(reloadedCache.contains(QStringLiteral("a")));
+    QVERIFY(!reloadedCache.contains(QStringLiteral("b")));
+}
+
+void SpreadsheetCacheTest::testCachedFileLoaded()
+{
+    const QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+    const quint64 limit{1024 * 1024};
+    SpreadsheetCache cache(directory.path() + "/", limit);
+    const QString key{QStringLiteral("a")};
+    QVERIFY(QFile::copy(DatasetUtilities::getDatasetsDir() + "ExampleData" +
+                            DatasetUtilities::getDatasetExtension(),
+                        cache.getPartialFilePath(key)));
+    QVERIFY(cache.insert(key, cache.getPartialFilePath(key)));
+
+    DatasetInner dataset(QStringLiteral("ExampleData"),
+                         cache.getFilePath(key));
+    QVERIFY(dataset.initialize());
+    QCOMPARE(dataset.getName(), QStringLiteral("ExampleData"));
+    DatasetCommon::activateAllDatasetColumns(dataset);
+    QVERIFY(dataset.loadData());
+    QCOMPARE(dataset.rowCount(), 55U);
+
+    // Statistics of cached file are kept next to it.
+    QVERIFY(QFile::exists(directory.filePath(
+        key + DatasetUtilities::getDatasetStatisticsExtension())));
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <QObject>
+
+/**
+ * @brief Tests for SpreadsheetCache class.
+ */
+class SpreadsheetCacheTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    static void testComputeKey();
+
+    static void testEviction();
+
+    static void testReloadedIndex();
+
+    static void testCachedFileLoaded();
+};
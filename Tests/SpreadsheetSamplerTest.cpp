@@ -0,0 +1,110 @@
+#include "SpreadsheetSamplerTest.h"
+
+#include <QtTest/QtTest>
+
+#include <Datasets/DatasetOds.h>
+#include <Datasets/DatasetXlsx.h>
+#include <Datasets/SpreadsheetSampler.h>
+
+#include "Common.h"
+
+namespace
+{
+std::unique_ptr<DatasetSpreadsheet> createSpreadsheet(const QString& fileName)
+{
+    const QString filePath{Common::getSpreadsheetsDir() + fileName};
+    if (fileName.endsWith(QStringLiteral(".ods")))
+        return std::make_unique<DatasetOds>(fileName, filePath);
+    return std::make_unique<DatasetXlsx>(fileName, filePath);
+}
+
+void addTestCasesForFileNames()
+{
+    QTest::addColumn<QString>("fileName");
+    const QStringList fileNames{QStringLiteral("HistVsNormal.xlsx"),
+                                QStringLiteral("HistVsNormal.ods")};
+    for (const QString& fileName : fileNames)
+        QTest::newRow(fileName.toStdString().c_str()) << fileName;
+}
+}  // namespace
+
+void SpreadsheetSamplerTest::testSampledColumnsMatchFullAnalysis_data()
+{
+    addTestCasesForFileNames();
+}
+
+void SpreadsheetSamplerTest::testSampledColumnsMatchFullAnalysis()
+{
+    QFETCH(const QString, fileName);
+    std::unique_ptr<DatasetSpreadsheet> sampled{createSpreadsheet(fileName)};
+    sampled->enableFastAnalysis(1'000);
+    QVERIFY(sampled->initialize());
+    std::unique_ptr<DatasetSpreadsheet> full{createSpreadsheet(fileName)};
+    QVERIFY(full->initialize());
+
+    QCOMPARE(sampled->columnCount(), full->columnCount());
+    QCOMPARE(sampled->rowCount(), full->rowCount());
+    for (int column = 0; column < static_cast<int>(full->columnCount());
+         ++column)
+    {
+        QCOMPARE(sampled->getHeaderName(column), full->getHeaderName(column));
+        QCOMPARE(sampled->getColumnFormat(column),
+                 full->getColumnFormat(column));
+    }
+    QCOMPARE(sampled->getSampleData().size(), full->getSampleData().size());
+}
+
+void SpreadsheetSamplerTest::testRowLimit_data()
+{
+    addTestCasesForFileNames();
+}
+
+void SpreadsheetSamplerTest::testRowLimit()
+{
+    QFETCH(const QString, fileName);
+    std::unique_ptr<DatasetSpreadsheet> dataset{createSpreadsheet(fileName)};
+    const unsigned int rowLimit{5};
+    dataset->enableFastAnalysis(rowLimit);
+    QVERIFY(dataset->initialize());
+
+    QCOMPARE(dataset->rowCount(), rowLimit);
+    QCOMPARE(dataset->getSampleData().size(),
+             static_cast<qsizetype>(rowLimit));
+}
+
+void SpreadsheetSamplerTest::testCreateSample()
+{
+    const QDate date(2020, 1, 2);
+    const SpreadsheetSampler::Sample sample{SpreadsheetSampler::createSample(
+        {{QStringLiteral("a"), QStringLiteral("b"), QString(),
+          QStringLiteral("d")},
+         {1.0, date, QStringLiteral("x"), 2.0},
+         {QVariant(), date, 3.0},
+         {4.0, QVariant(), QStringLiteral("y"), QStringLiteral("z")}})};
+
+    QCOMPARE(sample.columnNames_,
+             QStringList({QStringLiteral("a"), QStringLiteral("b"), QString(),
+                          QStringLiteral("d")}));
+    QCOMPARE(sample.columnTypes_,
+             QVector<ColumnType>({ColumnType::NUMBER, ColumnType::DATE,
+                                  ColumnType::STRING, ColumnType::STRING}));
+    QCOMPARE(sample.rows_.size(), static_cast<qsizetype>(3));
+    for (const auto& row : sample.rows_)
+        QCOMPARE(row.size(), static_cast<qsizetype>(4));
+
+    const SpreadsheetSampler::Sample headerOnly{
+        SpreadsheetSampler::createSample({{QStringLiteral("a")}})};
+    QCOMPARE(headerOnly.columnTypes_, QVector<ColumnType>{ColumnType::STRING});
+    QVERIFY(headerOnly.rows_.isEmpty());
+}
+
+void SpreadsheetSamplerTest::testMissingSheet()
+{
+    const QString filePath{Common::getSpreadsheetsDir() +
+                           QStringLiteral("HistVsNormal.xlsx")};
+    QVERIFY(!std::get<0>(
+        SpreadsheetSampler::readXlsx(filePath, QStringLiteral("missing"), 5)));
+    QVERIFY(!std::get<0>(SpreadsheetSampler::readOds(
+        Common::getSpreadsheetsDir() + QStringLiteral("HistVsNormal.ods"),
+        QStringLiteral("missing"), 5)));
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <QObject>
+
+/**
+ * @brief Tests for SpreadsheetSampler class and fast analysis of spreadsheets.
+ */
+class SpreadsheetSamplerTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    static void testSampledColumnsMatchFullAnalysis_data();
+    static void testSampledColumnsMatchFullAnalysis();
+
+    static void testRowLimit_data();
+    static void testRowLimit();
+
+    static void testCreateSample();
+
+    static void testMissingSheet();
+};
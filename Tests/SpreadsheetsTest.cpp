@@ -54,6 +54,46 @@ void SpreadsheetsTest::testDamagedFiles()
     QVERIFY(!dataset->initialize());
 }
 
+void SpreadsheetsTest::testChosenSheet_data()
+{
+    addTestCasesForFileNames({"testAccounts"});
+}
+
+void SpreadsheetsTest::testChosenSheet()
+{
+    QFETCH(const QString, fileName);
+    const QString filePath{Common::getSpreadsheetsDir() + fileName};
+
+    std::unique_ptr<Dataset> dataset{
+        DatasetCommon::createDataset(fileName, filePath)};
+    auto* spreadsheet{dynamic_cast<DatasetSpreadsheet*>(dataset.get())};
+    const auto [success, sheetNames] = spreadsheet->readSheetNames();
+    QVERIFY(success);
+    QVERIFY(!sheetNames.isEmpty());
+
+    spreadsheet->setSheetName(sheetNames.constLast());
+    QVERIFY(spreadsheet->initialize());
+    QCOMPARE(spreadsheet->getSheetName(), sheetNames.constLast());
+
+    dataset = DatasetCommon::createDataset(fileName, filePath);
+    spreadsheet = dynamic_cast<DatasetSpreadsheet*>(dataset.get());
+    spreadsheet->setSheetName(QStringLiteral("missing"));
+    QVERIFY(!spreadsheet->initialize());
+}
+
+void SpreadsheetsTest::testSharedStringsReused()
+{
+    const QString fileName{QStringLiteral("testAccounts.xlsx")};
+    const QString filePath{Common::getSpreadsheetsDir() + fileName};
+    DatasetXlsx first(fileName, filePath);
+    QVERIFY(first.initialize());
+
+    DatasetXlsx second(fileName, filePath);
+    second.setSharedStrings(first.getSharedStrings());
+    QVERIFY(second.initialize());
+    QCOMPARE(second.getSampleData(), first.getSampleData());
+}
+
 void SpreadsheetsTest::compareExpectedDefinitionsOfOdsAndXlsx_data()
 {
     addTestCaseForOdsAndXlsxComparison(
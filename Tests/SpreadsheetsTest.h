@@ -24,6 +24,11 @@ private Q_SLOTS:
     static void testDamagedFiles_data();
     static void testDamagedFiles();
 
+    static void testChosenSheet_data();
+    static void testChosenSheet();
+
+    static void testSharedStringsReused();
+
     void compareExpectedDefinitionsOfOdsAndXlsx_data();
     static void compareExpectedDefinitionsOfOdsAndXlsx();
 
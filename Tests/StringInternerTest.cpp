@@ -0,0 +1,111 @@
+#include "StringInternerTest.h"
+
+#include <QtTest/QtTest>
+
+#include <Common/DatasetUtilities.h>
+#include <Datasets/Dataset.h>
+#include <Datasets/StringInterner.h>
+
+#include "DatasetCommon.h"
+
+namespace
+{
+std::unique_ptr<Dataset> loadExampleData()
+{
+    std::unique_ptr<Dataset> dataset{DatasetCommon::createDataset(
+        QStringLiteral("ExampleData"), DatasetUtilities::getDatasetsDir())};
+    dataset->initialize();
+    DatasetCommon::activateAllDatasetColumns(*dataset);
+    dataset->loadData();
+    return dataset;
+}
+}  // namespace
+
+void StringInternerTest::testInternSharesData()
+{
+    StringInterner& interner{StringInterner::getInstance()};
+    QStringList strings{QStringLiteral("interned"),
+                        QString::fromLatin1("interned")};
+    QVERIFY(strings[0].constData() != strings[1].constData());
+
+    interner.intern(strings);
+    QCOMPARE(strings[0], QStringLiteral("interned"));
+    QCOMPARE(strings[0].constData(), strings[1].constData());
+    interner.release(strings);
+}
+
+void StringInternerTest::testRelease()
+{
+    StringInterner& interner{StringInterner::getInstance()};
+    const int initialSize{interner.size()};
+    QStringList strings{QStringLiteral("first"), QStringLiteral("second")};
+    interner.intern(strings);
+    const QString second{interner.intern(QStringLiteral("second"))};
+    QCOMPARE(interner.size(), initialSize + 2);
+
+    interner.release(strings);
+    QCOMPARE(interner.size(), initialSize + 1);
+
+    interner.release({second});
+    QCOMPARE(interner.size(), initialSize);
+}
+
+void StringInternerTest::testDecode()
+{
+    StringInterner& interner{StringInterner::getInstance()};
+    const QByteArray utf8{QStringLiteral("zażółć gęślą jaźń").toUtf8()};
+    const QString decoded{interner.decode(utf8)};
+    QCOMPARE(decoded, QStringLiteral("zażółć gęślą jaźń"));
+    QVERIFY(interner.decode({}).isEmpty());
+
+    const QString interned{interner.intern(decoded)};
+    QCOMPARE(interned.constData(), decoded.constData());
+    QCOMPARE(interner.decode(utf8).constData(), interned.constData());
+    interner.release({interned});
+}
+
+void StringInternerTest::testMemoryShare()
+{
+    StringInterner& interner{StringInterner::getInstance()};
+    const quint64 initialMemory{interner.getMemoryUsage()};
+    QStringList strings{QStringLiteral("shared first"),
+                        QStringLiteral("shared second")};
+    interner.intern(strings);
+    const quint64 singleUserShare{interner.getMemoryShare(strings)};
+    QCOMPARE(singleUserShare, interner.getMemoryUsage() - initialMemory);
+
+    QStringList copies{strings};
+    interner.intern(copies);
+    QCOMPARE(interner.getMemoryShare(strings) * 2, singleUserShare);
+    QCOMPARE(interner.getMemoryUsage() - initialMemory, singleUserShare);
+
+    interner.release(copies);
+    interner.release(strings);
+    QCOMPARE(interner.getMemoryShare(strings), 0ULL);
+}
+
+void StringInternerTest::testDatasetsShareStrings()
+{
+    const int initialSize{StringInterner::getInstance().size()};
+    std::unique_ptr<Dataset> first{loadExampleData()};
+    std::unique_ptr<Dataset> second{loadExampleData()};
+    const int sizeWithDatasets{StringInterner::getInstance().size()};
+    QVERIFY(sizeWithDatasets > initialSize);
+
+    for (Column column = 0; column < static_cast<int>(first->columnCount());
+         ++column)
+    {
+        if (first->getColumnFormat(column) != ColumnType::STRING)
+            continue;
+        const QStringList firstStrings{first->getStringList(column)};
+        const QStringList secondStrings{second->getStringList(column)};
+        QCOMPARE(firstStrings, secondStrings);
+        for (int i = 0; i < firstStrings.size(); ++i)
+            QCOMPARE(firstStrings[i].constData(), secondStrings[i].constData());
+    }
+
+    first.reset();
+    QCOMPARE(StringInterner::getInstance().size(), sizeWithDatasets);
+    second.reset();
+    QCOMPARE(StringInterner::getInstance().size(), initialSize);
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <QObject>
+
+/**
+ * @brief Tests for StringInterner class.
+ */
+class StringInternerTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    static void testInternSharesData();
+
+    static void testRelease();
+
+    static void testDecode();
+
+    static void testMemoryShare();
+
+    static void testDatasetsShareStrings();
+};
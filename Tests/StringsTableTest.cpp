@@ -0,0 +1,54 @@
+#include "StringsTableTest.h"
+
+#include <QtTest/QtTest>
+
+#include <Datasets/StringsTable.h>
+
+void StringsTableTest::testAppendLines()
+{
+    StringsTable table;
+    table.append({});
+    table.appendLines("first\nsecond\n\nlast");
+
+    QCOMPARE(table.size(), static_cast<qsizetype>(5));
+    QCOMPARE(table.getString(0), QString());
+    QCOMPARE(table.getString(1), QStringLiteral("first"));
+    QCOMPARE(table.getString(2), QStringLiteral("second"));
+    QCOMPARE(table.getString(3), QString());
+    QCOMPARE(table.getString(4), QStringLiteral("last"));
+}
+
+void StringsTableTest::testAppendAfterLines()
+{
+    StringsTable table;
+    table.appendLines("a\nb");
+    table.append("multi\nline");
+    table.appendLines("c");
+
+    QCOMPARE(table.size(), static_cast<qsizetype>(4));
+    QCOMPARE(table.getUtf8(1).toByteArray(), QByteArray("b"));
+    QCOMPARE(table.getString(2), QStringLiteral("multi\nline"));
+    QCOMPARE(table.getString(3), QStringLiteral("c"));
+}
+
+void StringsTableTest::testDecoding()
+{
+    const QString text{QStringLiteral("zażółć gęślą jaźń")};
+    StringsTable table;
+    table.appendLines(text.toUtf8() + "\nx");
+
+    QCOMPARE(table.getUtf8(0).size(), text.toUtf8().size());
+    QCOMPARE(table.getString(0), text);
+    QCOMPARE(table.getString(1), QStringLiteral("x"));
+}
+
+void StringsTableTest::testClear()
+{
+    StringsTable table;
+    table.appendLines("a\nb\nc");
+    QVERIFY(table.getMemoryUsage() > 0);
+
+    table.clear();
+    QVERIFY(table.isEmpty());
+    QCOMPARE(table.getMemoryUsage(), 0ULL);
+}
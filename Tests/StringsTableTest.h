@@ -0,0 +1,19 @@
+#pragma once
+
+#include <QObject>
+
+/**
+ * @brief Tests for StringsTable class.
+ */
+class StringsTableTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    static void testAppendLines();
+
+    static void testAppendAfterLines();
+
+    static void testDecoding();
+
+    static void testClear();
+};
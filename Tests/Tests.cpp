@@ -1,12 +1,23 @@
 #include <QtTest/QtTest>
 
 #include "ConfigurationTest.h"
+#include "DataBlockQueueTest.h"
+#include "DataColumnTest.h"
+#include "DatasetCatalogTest.h"
+#include "DatasetSnapshotTest.h"
 #include "DatasetTest.h"
 #include "DetailedSpreadsheetsTest.h"
 #include "FilteringProxyModelTest.h"
+#include "InnerLineTokenizerTest.h"
 #include "InnerTests.h"
+#include "LoadFilterTest.h"
 #include "PlotDataProviderTest.h"
+#include "SheetXmlSplitterTest.h"
+#include "SpreadsheetCacheTest.h"
+#include "SpreadsheetSamplerTest.h"
 #include "SpreadsheetsTest.h"
+#include "StringInternerTest.h"
+#include "StringsTableTest.h"
 
 int main(int argc, char* argv[])
 {
@@ -35,5 +46,38 @@ int main(int argc, char* argv[])
     DatasetTest datasetTest;
     QTest::qExec(&datasetTest);
 
+    DataColumnTest dataColumnTest;
+    QTest::qExec(&dataColumnTest);
+
+    DatasetSnapshotTest datasetSnapshotTest;
+    QTest::qExec(&datasetSnapshotTest);
+
+    StringInternerTest stringInternerTest;
+    QTest::qExec(&stringInternerTest);
+
+    InnerLineTokenizerTest innerLineTokenizerTest;
+    QTest::qExec(&innerLineTokenizerTest);
+
+    DataBlockQueueTest dataBlockQueueTest;
+    QTest::qExec(&dataBlockQueueTest);
+
+    StringsTableTest stringsTableTest;
+    QTest::qExec(&stringsTableTest);
+
+    LoadFilterTest loadFilterTest;
+    QTest::qExec(&loadFilterTest);
+
+    DatasetCatalogTest datasetCatalogTest;
+    QTest::qExec(&datasetCatalogTest);
+
+    SpreadsheetCacheTest spreadsheetCacheTest;
+    QTest::qExec(&spreadsheetCacheTest);
+
+    SpreadsheetSamplerTest spreadsheetSamplerTest;
+    QTest::qExec(&spreadsheetSamplerTest);
+
+    SheetXmlSplitterTest sheetXmlSplitterTest;
+    QTest::qExec(&sheetXmlSplitterTest);
+
     return 0;
 }
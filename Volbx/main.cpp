@@ -3,6 +3,7 @@
 
 #include <Common/Configuration.h>
 #include <Common/Constants.h>
+#include <Common/DatasetUtilities.h>
 #include <GUI/VolbxMain.h>
 #include <Shared/Application.h>
 #include <Shared/Logger.h>
@@ -37,6 +38,8 @@ int main(int argc, char* argv[])
 
     overwriteUpdaterfIfNeeded();
 
+    DatasetUtilities::clearSpillDir();
+
     // Create new or load existing configuration.
     Configuration::getInstance();
 